@@ -0,0 +1,132 @@
+/**
+ * @file circle_tables_gen.c
+ *
+ * @brief Generador de las tablas de círculos precalculadas de LVGL.
+ *
+ * Calcula con el mismo código de LVGL el borde con antialiasing de cada radio de
+ * LV_CIRCLE_TABLE_RADII (lv_conf.h) y escribe src/circle_tables.c, que el firmware guarda en
+ * flash en lugar de calcular los círculos al dibujar. Se corre con el target
+ * circle_tables_update después de cambiar la lista de radios.
+ *
+ * Uso: circle_tables [archivo], sin archivo escribe en la salida estándar.
+ *
+ * @see lv_draw_mask.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../lvgl/lvgl.h"
+
+#if LV_USE_CIRCLE_TABLES
+
+static const uint16_t radii[] = {LV_CIRCLE_TABLE_RADII};
+#define RADII_CNT (sizeof(radii) / sizeof(radii[0]))
+
+/**
+ * @brief Escribe un arreglo de C con 16 valores por línea.
+ *
+ * @param out Archivo de salida.
+ * @param type Tipo de los elementos.
+ * @param name Nombre del arreglo.
+ * @param radius Radio, sufijo del nombre.
+ * @param values Valores, de 8 o 16 bits según @p wide.
+ * @param wide true si los valores son uint16_t.
+ * @param cnt Cantidad de valores.
+ */
+static void dump_array(FILE *out, const char *type, const char *name, uint16_t radius, const void *values,
+                       bool wide, uint32_t cnt) {
+    fprintf(out, "static const %s %s_%u[%u] = {", type, name, radius, cnt);
+    for (uint32_t i = 0; i < cnt; i++) {
+        uint32_t v = wide ? ((const uint16_t *)values)[i] : ((const uint8_t *)values)[i];
+        fprintf(out, "%s%u%s", (i % 16) ? " " : "\n    ", v, (i + 1 < cnt) ? "," : "");
+    }
+    fprintf(out, "\n};\n");
+}
+
+/**
+ * @brief Revisa que la tabla de un radio sea coherente: filas crecientes dentro del buffer.
+ *
+ * @return true si la tabla se puede guardar.
+ */
+static bool check_circle(const _lv_draw_mask_radius_circle_dsc_t *c, uint16_t radius) {
+    for (uint16_t y = 0; y < radius; y++) {
+        if (c->opa_start_on_y[y + 1] < c->opa_start_on_y[y]) return false;
+    }
+    return c->opa_start_on_y[radius] <= 2 * radius + 2;
+}
+
+int main(int argc, char **argv) {
+    FILE *out = stdout;
+
+    lv_init();
+
+    for (uint32_t i = 1; i < RADII_CNT; i++) {
+        if (radii[i] <= radii[i - 1]) {
+            fprintf(stderr, "LV_CIRCLE_TABLE_RADII tiene que ir en orden creciente y sin repetidos\n");
+            return 1;
+        }
+    }
+    if (radii[0] < 2) {
+        fprintf(stderr, "LV_CIRCLE_TABLE_RADII empieza en 2, el radio 1 es un caso especial de LVGL\n");
+        return 1;
+    }
+
+    if (argc > 1) {
+        out = fopen(argv[1], "w");
+        if (!out) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    fprintf(out, "/**\n");
+    fprintf(out, " * @file circle_tables.c\n");
+    fprintf(out, " *\n");
+    fprintf(out, " * @brief Círculos con antialiasing precalculados para los radios de LV_CIRCLE_TABLE_RADII.\n");
+    fprintf(out, " *\n");
+    fprintf(out, " * Generado por host/circle_tables_gen.c con el target circle_tables_update, no editar.\n");
+    fprintf(out, " */\n\n");
+    fprintf(out, "#include \"../lvgl/lvgl.h\"\n\n");
+    fprintf(out, "#if LV_USE_CIRCLE_TABLES\n\n");
+
+    for (uint32_t i = 0; i < RADII_CNT; i++) {
+        uint16_t r = radii[i];
+        _lv_draw_mask_radius_circle_dsc_t c = {0};
+
+        _lv_draw_mask_circle_calc(&c, r);
+        if (!check_circle(&c, r)) {
+            fprintf(stderr, "tabla incoherente para el radio %u\n", r);
+            return 1;
+        }
+
+        dump_array(out, "lv_opa_t", "circle_opa", r, c.cir_opa, false, c.opa_start_on_y[r]);
+        dump_array(out, "uint16_t", "circle_opa_start", r, c.opa_start_on_y, true, r + 1);
+        dump_array(out, "uint16_t", "circle_x_start", r, c.x_start_on_y, true, r);
+        fprintf(out, "\n");
+        lv_mem_free(c.buf);
+    }
+
+    // Sin buf, lv_draw_mask_free_param() no las cuenta ni las libera
+    fprintf(out, "const _lv_draw_mask_radius_circle_dsc_t _lv_circle_tables[] = {\n");
+    for (uint32_t i = 0; i < RADII_CNT; i++) {
+        uint16_t r = radii[i];
+        fprintf(out, "    {NULL, (lv_opa_t *)circle_opa_%u, (uint16_t *)circle_x_start_%u, "
+                     "(uint16_t *)circle_opa_start_%u, 1, 0, %u},\n", r, r, r, r);
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "const uint16_t _lv_circle_tables_cnt = %u;\n\n", (unsigned)RADII_CNT);
+    fprintf(out, "#endif /*LV_USE_CIRCLE_TABLES*/\n");
+
+    if (out != stdout) fclose(out);
+    return 0;
+}
+
+#else
+
+int main(void) {
+    fprintf(stderr, "LV_USE_CIRCLE_TABLES está deshabilitado en lv_conf.h, no hay tablas que generar\n");
+    return 1;
+}
+
+#endif /*LV_USE_CIRCLE_TABLES*/
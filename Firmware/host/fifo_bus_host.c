@@ -0,0 +1,101 @@
+/**
+ * @file fifo_bus_host.c
+ *
+ * @brief Tiempo de bus I2C por segundo de PPG de las formas de leer la FIFO del MAX30102.
+ *
+ * Sin la placa el tiempo se calcula con las transacciones que hace max30102.c: una lectura de k
+ * bytes de un registro son START, dirección, registro, RESTART, dirección, k bytes y STOP, unos
+ * 30 + 9k bits en el bus. No incluye el tiempo de la CPU entre la escritura del registro y la
+ * lectura de las funciones bloqueantes del SDK, que alarga cada transacción unos microsegundos.
+ *
+ * - por muestra: la interrupción PPG_RDY de cada muestra, dos lecturas de punteros y por muestra
+ *   IRQ_STATUS1, IRQ_STATUS2 y 6 bytes de FIFO_DATA.
+ * - A_FULL, por muestra: igual pero leyendo las 17 muestras que hay al interrumpir A_FULL.
+ * - A_FULL, ráfaga: IRQ_STATUS1 a FIFO_RD_PTR en una lectura y toda la FIFO en otra.
+ *
+ *     ./build_host/fifo_bus_host -f 400000
+ *
+ * @see max30102.c
+ * @see i2c_driver.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*! @brief Muestras en la FIFO al interrumpir A_FULL, 32 - MAX_FIFO_AFULL*/
+#define HOST_AFULL_SAMPLES 17
+/*! @brief Bytes de una muestra, rojo e IR de 3 bytes*/
+#define HOST_SAMPLE_BYTES 6
+/*! @brief Bytes de IRQ_STATUS1 a FIFO_RD_PTR*/
+#define HOST_STATUS_BYTES 7
+
+/**
+ * @brief Una forma de leer la FIFO.
+ */
+typedef struct
+{
+    const char *name;       /**< Nombre en el reporte*/
+    unsigned samples;       /**< Muestras por lectura de la FIFO*/
+    unsigned reads;         /**< Lecturas de un registro por lectura de la FIFO*/
+    unsigned reads_sample;  /**< Lecturas de un registro por muestra, sin la de FIFO_DATA*/
+    unsigned burst;         /**< FIFO_DATA se lee de una vez y no por muestra*/
+} host_fifo_read_t;
+
+/**
+ * @brief Bits en el bus de una lectura de len bytes de un registro.
+ */
+static unsigned host_read_bits(unsigned len) {
+    return 30 + 9 * len;
+}
+
+/**
+ * @brief Bits en el bus de una lectura de la FIFO con sus muestras.
+ *
+ * @param r forma de leer.
+ * @param transactions transacciones de la lectura.
+ */
+static unsigned host_fifo_bits(const host_fifo_read_t *r, unsigned *transactions) {
+    if (r->burst) {
+        *transactions = 2;
+        return host_read_bits(HOST_STATUS_BYTES) + host_read_bits(r->samples * HOST_SAMPLE_BYTES);
+    }
+    *transactions = r->reads + r->samples * (r->reads_sample + 1);
+    return r->reads * host_read_bits(1) +
+           r->samples * (r->reads_sample * host_read_bits(1) + host_read_bits(HOST_SAMPLE_BYTES));
+}
+
+int main(int argc, char **argv) {
+    static const host_fifo_read_t reads[] = {
+        {"per sample", 1, 2, 2, 0},
+        {"a_full, per sample", HOST_AFULL_SAMPLES, 2, 2, 0},
+        {"a_full, burst", HOST_AFULL_SAMPLES, 0, 0, 1},
+    };
+    static const unsigned rates[] = {50, 100, 400};
+    unsigned freq = 400000;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "f:")) != -1) {
+        switch (opt) {
+            case 'f': freq = strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "uso: %s [-f frecuencia del I2C]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (freq == 0) return 1;
+
+    fprintf(stderr, "i2c %u Hz, bus time per second of ppg\n", freq);
+    for (unsigned i = 0; i < sizeof(reads) / sizeof(reads[0]); i++) {
+        unsigned transactions;
+        unsigned bits = host_fifo_bits(&reads[i], &transactions);
+        fprintf(stderr, "%-20s %5.1f bits/sample", reads[i].name, (double)bits / reads[i].samples);
+        for (unsigned k = 0; k < sizeof(rates) / sizeof(rates[0]); k++) {
+            double per_s = (double)rates[k] / reads[i].samples;
+            fprintf(stderr, ", %u Hz: %6.2f ms %5.0f transactions", rates[k], per_s * bits * 1000.0 / freq,
+                    per_s * transactions);
+        }
+        fprintf(stderr, "\n");
+    }
+    return 0;
+}
@@ -0,0 +1,400 @@
+/**
+ * @file font_subsets_gen.c
+ *
+ * @brief Generador de las fuentes recortadas del firmware.
+ *
+ * Se compila con @c FONT_SUBSETS en 0 junto a las fuentes Montserrat completas de LVGL y copia de
+ * cada una solo los glifos de su lista de font_subsets.h: bitmaps, descriptores, kerning por
+ * clases y un cmap de acceso directo para el rango ASCII. Escribe src/font_subsets.c y reporta en
+ * stderr los bytes de cada fuente antes y después. Se corre con el target font_subsets_update.
+ *
+ * Uso: font_subsets [archivo], sin archivo escribe en la salida estándar. El archivo solo se
+ * reemplaza si todas las fuentes se pudieron recortar.
+ *
+ * @see font_subsets.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/font_subsets.h"
+
+#if !FONT_SUBSETS
+
+/*! @brief Glifos que puede tener una fuente recortada, sin contar el glifo 0 reservado */
+#define SUBSET_MAX_GLYPHS 128
+
+/**
+ * @brief Fuente a recortar.
+ */
+typedef struct
+{
+    const lv_font_t *font;      /**< Fuente completa de LVGL*/
+    const char *name;           /**< Nombre de la fuente recortada*/
+    const char *glyphs;         /**< Caracteres a conservar, en UTF-8*/
+} subset_t;
+
+static const subset_t subsets[] = {
+    {&lv_font_montserrat_10, "montserrat_10_subset", FONT_SUBSET_GLYPHS_10},
+    {&lv_font_montserrat_14, "montserrat_14_subset", FONT_SUBSET_GLYPHS_14},
+    {&lv_font_montserrat_18, "montserrat_18_subset", FONT_SUBSET_GLYPHS_18},
+    {&lv_font_montserrat_48, "montserrat_48_subset", FONT_SUBSET_GLYPHS_48},
+};
+
+/**
+ * @brief Busca el glifo de un caracter en los cmaps de una fuente, en cualquiera de sus formatos.
+ *
+ * @return id del glifo, 0 si la fuente no lo tiene.
+ */
+static uint32_t glyph_id(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter) {
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (letter < cmap->range_start || rcp >= cmap->range_length) continue;
+
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) return cmap->glyph_id_start + rcp;
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+        }
+        for (uint16_t j = 0; j < cmap->list_length; j++) {
+            if (cmap->unicode_list[j] != rcp) continue;
+            if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + j;
+            return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[j];
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Bytes del bitmap de un glifo, cada glifo empieza en un byte.
+ */
+static uint32_t glyph_bytes(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t gid) {
+    const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[gid];
+    return ((uint32_t)g->box_w * g->box_h * fdsc->bpp + 7) / 8;
+}
+
+/**
+ * @brief Ordena y quita repetidos de los caracteres de una lista UTF-8.
+ *
+ * @return cantidad de caracteres en @p letters.
+ */
+static uint32_t parse_letters(const char *glyphs, uint32_t *letters) {
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+
+    while (glyphs[i]) {
+        uint32_t letter = _lv_txt_encoded_next(glyphs, &i);
+        uint32_t pos = 0;
+        while (pos < cnt && letters[pos] < letter) pos++;
+        if (pos < cnt && letters[pos] == letter) continue;
+        if (cnt == SUBSET_MAX_GLYPHS) return 0;
+        memmove(&letters[pos + 1], &letters[pos], (cnt - pos) * sizeof(letters[0]));
+        letters[pos] = letter;
+        cnt++;
+    }
+    return cnt;
+}
+
+/**
+ * @brief Bytes de los datos constantes de una fuente completa: bitmaps, descriptores, cmaps y kerning.
+ */
+static uint32_t font_size(const lv_font_fmt_txt_dsc_t *fdsc) {
+    uint32_t glyphs = 0;
+    uint32_t size = sizeof(lv_font_t) + sizeof(lv_font_fmt_txt_dsc_t);
+
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t ids = cmap->glyph_id_start + (cmap->list_length ? cmap->list_length : cmap->range_length);
+        if (ids > glyphs) glyphs = ids;
+
+        size += sizeof(*cmap);
+        if (cmap->unicode_list) size += cmap->list_length * sizeof(uint16_t);
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) size += cmap->range_length;
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) size += cmap->list_length * sizeof(uint16_t);
+    }
+    size += glyphs * sizeof(lv_font_fmt_txt_glyph_dsc_t);
+    size += fdsc->glyph_dsc[glyphs - 1].bitmap_index + glyph_bytes(fdsc, glyphs - 1);
+
+    if (fdsc->kern_dsc) {
+        const lv_font_fmt_txt_kern_classes_t *kern = fdsc->kern_dsc;
+        size += sizeof(*kern) + 2 * glyphs + kern->left_class_cnt * kern->right_class_cnt;
+    }
+    return size;
+}
+
+/**
+ * @brief Escribe un arreglo de C con 16 valores por línea.
+ */
+static void dump_values(FILE *out, const char *decl, const void *values, uint8_t size, bool is_signed, uint32_t cnt) {
+    fprintf(out, "%s = {", decl);
+    for (uint32_t i = 0; i < cnt; i++) {
+        int32_t v;
+        if (size == 1) v = is_signed ? ((const int8_t *)values)[i] : ((const uint8_t *)values)[i];
+        else v = ((const uint16_t *)values)[i];
+        fprintf(out, "%s%d%s", (i % 16) ? " " : "\n    ", v, (i + 1 < cnt) ? "," : "");
+    }
+    fprintf(out, "\n};\n");
+}
+
+/**
+ * @brief Escribe la fuente recortada de un @ref subset_t.
+ *
+ * @return bytes de los datos constantes de la fuente recortada, 0 si falta un caracter.
+ */
+static uint32_t dump_subset(FILE *out, const subset_t *s) {
+    const lv_font_fmt_txt_dsc_t *fdsc = s->font->dsc;
+    uint32_t letters[SUBSET_MAX_GLYPHS];
+    uint32_t src_ids[SUBSET_MAX_GLYPHS + 1] = {0};
+    uint32_t cnt = parse_letters(s->glyphs, letters);
+    uint32_t size = sizeof(lv_font_t) + sizeof(lv_font_fmt_txt_dsc_t);
+    char decl[96];
+
+    if (cnt == 0) {
+        fprintf(stderr, "%s: lista vacía o con más de %d caracteres\n", s->name, SUBSET_MAX_GLYPHS);
+        return 0;
+    }
+
+    // El glifo 0 queda reservado, LVGL lo toma como "no encontrado"
+    for (uint32_t i = 0; i < cnt; i++) {
+        src_ids[i + 1] = glyph_id(fdsc, letters[i]);
+        if (!src_ids[i + 1]) {
+            fprintf(stderr, "%s: la fuente no tiene el caracter U+%04X\n", s->name, letters[i]);
+            return 0;
+        }
+    }
+
+    fprintf(out, "/*-----------------\n * %s\n *----------------*/\n\n", s->name);
+
+    // Bitmaps
+    uint32_t bitmap_len = 0;
+    fprintf(out, "static LV_ATTRIBUTE_LARGE_CONST const uint8_t %s_bitmap[] = {", s->name);
+    for (uint32_t id = 1; id <= cnt; id++) {
+        const uint8_t *bitmap = &fdsc->glyph_bitmap[fdsc->glyph_dsc[src_ids[id]].bitmap_index];
+        uint32_t bytes = glyph_bytes(fdsc, src_ids[id]);
+        fprintf(out, "\n    /* U+%04X */", letters[id - 1]);
+        for (uint32_t b = 0; b < bytes; b++) {
+            fprintf(out, "%s0x%02x,", (b % 16) ? " " : "\n    ", bitmap[b]);
+        }
+        bitmap_len += bytes;
+    }
+    fprintf(out, "\n};\n\n");
+    size += bitmap_len;
+
+    // Descriptores con el índice del bitmap recortado
+    uint32_t bitmap_index = 0;
+    fprintf(out, "static const lv_font_fmt_txt_glyph_dsc_t %s_glyph_dsc[] = {\n", s->name);
+    fprintf(out, "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */");
+    for (uint32_t id = 1; id <= cnt; id++) {
+        const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[src_ids[id]];
+        fprintf(out, ",\n    {.bitmap_index = %u, .adv_w = %u, .box_w = %u, .box_h = %u, .ofs_x = %d, .ofs_y = %d}",
+                bitmap_index, (unsigned)g->adv_w, (unsigned)g->box_w, (unsigned)g->box_h, g->ofs_x, g->ofs_y);
+        bitmap_index += glyph_bytes(fdsc, src_ids[id]);
+    }
+    fprintf(out, "\n};\n\n");
+    size += (cnt + 1) * sizeof(lv_font_fmt_txt_glyph_dsc_t);
+
+    // Un cmap para los caracteres ASCII: sin lista si son consecutivos, si no con el id de cada uno
+    // (0 para los que no están) y el resto en un cmap disperso
+    uint32_t ascii_cnt = 0;
+    while (ascii_cnt < cnt && letters[ascii_cnt] < 0x80) ascii_cnt++;
+    uint32_t cmap_num = 0;
+    char cmaps[2][256];
+
+    if (ascii_cnt) {
+        uint32_t start = letters[0];
+        uint32_t len = letters[ascii_cnt - 1] - start + 1;
+        if (len == ascii_cnt) {
+            snprintf(cmaps[cmap_num++], sizeof(cmaps[0]),
+                     "{.range_start = %u, .range_length = %u, .glyph_id_start = 1, .unicode_list = NULL, "
+                     ".glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}",
+                     start, len);
+        } else {
+            uint8_t ofs[0x80] = {0};
+            for (uint32_t i = 0; i < ascii_cnt; i++) ofs[letters[i] - start] = i + 1;
+            snprintf(decl, sizeof(decl), "static const uint8_t %s_ascii_ids[]", s->name);
+            dump_values(out, decl, ofs, 1, false, len);
+            fprintf(out, "\n");
+            snprintf(cmaps[cmap_num++], sizeof(cmaps[0]),
+                     "{.range_start = %u, .range_length = %u, .glyph_id_start = 0, .unicode_list = NULL, "
+                     ".glyph_id_ofs_list = %s_ascii_ids, .list_length = %u, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL}",
+                     start, len, s->name, len);
+            size += len;
+        }
+    }
+    if (ascii_cnt < cnt) {
+        uint16_t rcp[SUBSET_MAX_GLYPHS];
+        uint32_t start = letters[ascii_cnt];
+        uint32_t len = letters[cnt - 1] - start + 1;
+        if (len > UINT16_MAX) {
+            fprintf(stderr, "%s: los caracteres fuera de ASCII no caben en un cmap\n", s->name);
+            return 0;
+        }
+        for (uint32_t i = ascii_cnt; i < cnt; i++) rcp[i - ascii_cnt] = letters[i] - start;
+        snprintf(decl, sizeof(decl), "static const uint16_t %s_unicode_list[]", s->name);
+        dump_values(out, decl, rcp, 2, false, cnt - ascii_cnt);
+        fprintf(out, "\n");
+        snprintf(cmaps[cmap_num++], sizeof(cmaps[0]),
+                 "{.range_start = %u, .range_length = %u, .glyph_id_start = %u, .unicode_list = %s_unicode_list, "
+                 ".glyph_id_ofs_list = NULL, .list_length = %u, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY}",
+                 start, len, ascii_cnt + 1, s->name, cnt - ascii_cnt);
+        size += (cnt - ascii_cnt) * sizeof(uint16_t);
+    }
+    fprintf(out, "static const lv_font_fmt_txt_cmap_t %s_cmaps[] = {\n", s->name);
+    for (uint32_t i = 0; i < cmap_num; i++) fprintf(out, "    %s%s\n", cmaps[i], (i + 1 < cmap_num) ? "," : "");
+    fprintf(out, "};\n\n");
+    size += cmap_num * sizeof(lv_font_fmt_txt_cmap_t);
+
+    // Kerning por clases, solo con las clases que usan los glifos que quedan
+    bool kern = false;
+    if (fdsc->kern_dsc) {
+        const lv_font_fmt_txt_kern_classes_t *src = fdsc->kern_dsc;
+        uint8_t left[SUBSET_MAX_GLYPHS + 1] = {0}, right[SUBSET_MAX_GLYPHS + 1] = {0};
+        uint8_t left_map[256] = {0}, right_map[256] = {0};
+        uint8_t left_src[256], right_src[256];
+        uint32_t left_cnt = 0, right_cnt = 0;
+
+        if (!fdsc->kern_classes) {
+            fprintf(stderr, "%s: solo se recorta el kerning por clases\n", s->name);
+            return 0;
+        }
+        for (uint32_t id = 1; id <= cnt; id++) {
+            uint8_t lc = src->left_class_mapping[src_ids[id]];
+            uint8_t rc = src->right_class_mapping[src_ids[id]];
+            if (lc && !left_map[lc]) {
+                left_src[left_cnt] = lc;
+                left_map[lc] = ++left_cnt;
+            }
+            if (rc && !right_map[rc]) {
+                right_src[right_cnt] = rc;
+                right_map[rc] = ++right_cnt;
+            }
+            left[id] = left_map[lc];
+            right[id] = right_map[rc];
+        }
+
+        static int8_t values[255 * 255];
+        bool any = false;
+        for (uint32_t l = 0; l < left_cnt; l++) {
+            for (uint32_t r = 0; r < right_cnt; r++) {
+                int8_t v = src->class_pair_values[(left_src[l] - 1) * src->right_class_cnt + (right_src[r] - 1)];
+                values[l * right_cnt + r] = v;
+                any |= v != 0;
+            }
+        }
+
+        if (any) {
+            snprintf(decl, sizeof(decl), "static const uint8_t %s_kern_left_class_mapping[]", s->name);
+            dump_values(out, decl, left, 1, false, cnt + 1);
+            snprintf(decl, sizeof(decl), "static const uint8_t %s_kern_right_class_mapping[]", s->name);
+            dump_values(out, decl, right, 1, false, cnt + 1);
+            snprintf(decl, sizeof(decl), "static const int8_t %s_kern_class_values[]", s->name);
+            dump_values(out, decl, values, 1, true, left_cnt * right_cnt);
+            fprintf(out, "\nstatic const lv_font_fmt_txt_kern_classes_t %s_kern_classes = {\n", s->name);
+            fprintf(out, "    .class_pair_values = %s_kern_class_values,\n", s->name);
+            fprintf(out, "    .left_class_mapping = %s_kern_left_class_mapping,\n", s->name);
+            fprintf(out, "    .right_class_mapping = %s_kern_right_class_mapping,\n", s->name);
+            fprintf(out, "    .left_class_cnt = %u,\n    .right_class_cnt = %u,\n};\n\n", left_cnt, right_cnt);
+            size += sizeof(*src) + 2 * (cnt + 1) + left_cnt * right_cnt;
+            kern = true;
+        }
+    }
+
+    fprintf(out, "static lv_font_fmt_txt_glyph_cache_t %s_cache;\n\n", s->name);
+    fprintf(out, "static const lv_font_fmt_txt_dsc_t %s_dsc = {\n", s->name);
+    fprintf(out, "    .glyph_bitmap = %s_bitmap,\n", s->name);
+    fprintf(out, "    .glyph_dsc = %s_glyph_dsc,\n", s->name);
+    fprintf(out, "    .cmaps = %s_cmaps,\n", s->name);
+    if (kern) fprintf(out, "    .kern_dsc = &%s_kern_classes,\n", s->name);
+    else fprintf(out, "    .kern_dsc = NULL,\n");
+    fprintf(out, "    .kern_scale = %u,\n", fdsc->kern_scale);
+    fprintf(out, "    .cmap_num = %u,\n", cmap_num);
+    fprintf(out, "    .bpp = %u,\n", fdsc->bpp);
+    fprintf(out, "    .kern_classes = %u,\n", kern ? 1 : 0);
+    fprintf(out, "    .bitmap_format = %u,\n", fdsc->bitmap_format);
+    fprintf(out, "    .cache = &%s_cache\n};\n\n", s->name);
+
+    // Mismas métricas de línea que la fuente completa, así el layout no cambia
+    fprintf(out, "const lv_font_t %s = {\n", s->name);
+    fprintf(out, "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,\n");
+    fprintf(out, "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,\n");
+    fprintf(out, "    .line_height = %d,\n", s->font->line_height);
+    fprintf(out, "    .base_line = %d,\n", s->font->base_line);
+    fprintf(out, "    .subpx = %u,\n", s->font->subpx);
+    fprintf(out, "    .underline_position = %d,\n", s->font->underline_position);
+    fprintf(out, "    .underline_thickness = %d,\n", s->font->underline_thickness);
+    fprintf(out, "    .dsc = &%s_dsc\n};\n\n", s->name);
+
+    return size;
+}
+
+int main(int argc, char **argv) {
+    FILE *out = stdout;
+    char tmp_path[512];
+    uint32_t sizes[sizeof(subsets) / sizeof(subsets[0])];
+
+    for (uint32_t i = 0; i < sizeof(subsets) / sizeof(subsets[0]); i++) {
+        if (((const lv_font_fmt_txt_dsc_t *)subsets[i].font->dsc)->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+            fprintf(stderr, "%s: solo se recortan fuentes sin comprimir\n", subsets[i].name);
+            return 1;
+        }
+    }
+
+    if (argc > 1) {
+        snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", argv[1]);
+        out = fopen(tmp_path, "w");
+        if (!out) {
+            perror(tmp_path);
+            return 1;
+        }
+    }
+
+    fprintf(out, "/**\n");
+    fprintf(out, " * @file font_subsets.c\n");
+    fprintf(out, " *\n");
+    fprintf(out, " * @brief Fuentes Montserrat recortadas a los caracteres de font_subsets.h.\n");
+    fprintf(out, " *\n");
+    fprintf(out, " * Generado por host/font_subsets_gen.c con el target font_subsets_update, no editar.\n");
+    fprintf(out, " */\n\n");
+    fprintf(out, "#include \"../include/font_subsets.h\"\n\n");
+    fprintf(out, "#if FONT_SUBSETS\n\n");
+
+    for (uint32_t i = 0; i < sizeof(subsets) / sizeof(subsets[0]); i++) {
+        sizes[i] = dump_subset(out, &subsets[i]);
+        if (!sizes[i]) {
+            if (out != stdout) {
+                fclose(out);
+                remove(tmp_path);
+            }
+            return 1;
+        }
+    }
+
+    fprintf(out, "#endif /*FONT_SUBSETS*/\n");
+    if (out != stdout) {
+        fclose(out);
+        if (rename(tmp_path, argv[1]) != 0) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    uint32_t total_full = 0, total_subset = 0;
+    for (uint32_t i = 0; i < sizeof(subsets) / sizeof(subsets[0]); i++) {
+        uint32_t full = font_size(subsets[i].font->dsc);
+        fprintf(stderr, "%s: %u bytes -> %u bytes\n", subsets[i].name, full, sizes[i]);
+        total_full += full;
+        total_subset += sizes[i];
+    }
+    fprintf(stderr, "total: %u bytes -> %u bytes\n", total_full, total_subset);
+    return 0;
+}
+
+#else
+
+int main(void) {
+    fprintf(stderr, "font_subsets se compila con FONT_SUBSETS en 0, junto a las fuentes completas\n");
+    return 1;
+}
+
+#endif /*!FONT_SUBSETS*/
@@ -0,0 +1,506 @@
+/**
+ * @file host_display.c
+ *
+ * @brief Backend del display sin pantalla para medir el render de LVGL en el PC.
+ *
+ * Compila las pantallas de screens.c y LVGL contra un framebuffer RGB565 de 240x240 en memoria.
+ * Simula el bucle principal del firmware con un tick fijo y por cada cuadro imprime en CSV el
+ * tiempo de render, los pixeles renderizados y los bytes que se enviarían al LCD, con y sin
+ * el recorte de la pantalla redonda. Puede guardar cuadros en PPM para revisarlos o compararlos.
+ *
+ * Uso: display_host [-n cuadros] [-o carpeta] [-e cada] [-f cuadro] [-t cambios] [-g vueltas] [-a cambios]
+ *   -n  cuadros a simular, por defecto @ref HOST_FRAMES
+ *   -o  carpeta donde guardar los PPM, sin ella no se guarda ninguno
+ *   -e  guardar un PPM cada tantos cuadros
+ *   -f  guardar el PPM de un cuadro, se puede repetir
+ *   -t  en lugar de simular, medir el render del label de la hora en tantos cambios de minuto
+ *   -g  en lugar de simular, medir la busqueda de glifos y kerning de las fuentes en tantas vueltas
+ *   -a  en lugar de simular, medir el render de los arcos en tantos cambios de valor
+ *
+ * @see host_hw.c
+ * @see screens.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../include/screens.h"
+
+/*! @brief Resolución horizontal, igual a DISP_HOR_RES de lib.h */
+#define HOST_HOR_RES 240
+/*! @brief Resolución vertical, igual a DISP_VER_RES de lib.h */
+#define HOST_VER_RES 240
+/*! @brief Alto de cada strip de render, igual a DISP_STRIP_LINES de lib.h */
+#define HOST_STRIP_LINES 40
+/*! @brief Tiempo simulado entre llamadas a lv_timer_handler(), el periodo de refresco de LVGL */
+#define HOST_FRAME_MS LV_DISP_DEF_REFR_PERIOD
+/*! @brief Cuadros simulados por defecto, 10 s */
+#define HOST_FRAMES 1000
+/*! @brief Máximo de cuadros sueltos que se pueden pedir con -f */
+#define HOST_MAX_DUMPS 16
+
+static uint16_t framebuffer[HOST_HOR_RES * HOST_VER_RES];
+
+static lv_disp_draw_buf_t disp_buf;
+static lv_color_t buf0[HOST_HOR_RES * HOST_STRIP_LINES];
+static lv_color_t buf1[HOST_HOR_RES * HOST_STRIP_LINES];
+static lv_disp_drv_t disp_drv;
+
+/**
+ * @brief Columnas visibles de cada fila de la pantalla redonda, mismo criterio que LCD_SetRoundClip().
+ */
+static struct {
+    int16_t x1[HOST_VER_RES];
+    int16_t x2[HOST_VER_RES];
+} host_round;
+
+/**
+ * @brief Estadisticas de un cuadro.
+ */
+typedef struct {
+    uint32_t render_us;     /**< Tiempo de lv_timer_handler() en us*/
+    uint32_t px;            /**< Pixeles renderizados, reportados por el monitor_cb*/
+    uint32_t flush_bytes;   /**< Bytes de las areas enviadas al LCD*/
+    uint32_t round_bytes;   /**< Bytes enviados si solo se envian los pixeles dentro del circulo*/
+    uint32_t flushes;       /**< Areas enviadas*/
+} host_frame_t;
+
+static host_frame_t frame;
+
+/*! @brief Tiempo dentro de lv_draw_arc() de los arcos medidos con -a, en ns */
+static uint64_t arc_draw_ns;
+static uint64_t arc_draw_start_ns;
+
+static uint32_t host_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+static uint64_t host_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void host_round_init(void) {
+    int32_t d = HOST_HOR_RES < HOST_VER_RES ? HOST_HOR_RES : HOST_VER_RES;
+
+    for (int32_t y = 0; y < HOST_VER_RES; y++) {
+        int32_t dy = 2 * y + 1 - HOST_VER_RES;
+        int32_t rest = d * d - dy * dy;
+        int32_t s = 0;
+
+        host_round.x1[y] = 1;
+        host_round.x2[y] = 0;
+        if (rest < 0) continue;
+
+        while ((s + 1) * (s + 1) <= rest) s++;
+        host_round.x1[y] = (HOST_HOR_RES - s) / 2;
+        host_round.x2[y] = (HOST_HOR_RES - 1 + s) / 2;
+    }
+}
+
+/**
+ * @brief Copia el area al framebuffer y cuenta los bytes que el firmware enviaria por SPI.
+ */
+static void host_flush_cb(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+{
+    int32_t w = lv_area_get_width(area);
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        const lv_color_t *row = color_p + (y - area->y1) * w;
+        int32_t x1 = LV_MAX(area->x1, host_round.x1[y]);
+        int32_t x2 = LV_MIN(area->x2, host_round.x2[y]);
+
+        memcpy(&framebuffer[y * HOST_HOR_RES + area->x1], row, w * sizeof(lv_color_t));
+        if (x1 <= x2) frame.round_bytes += (x2 - x1 + 1) * 2;
+    }
+
+    frame.flush_bytes += lv_area_get_size(area) * 2;
+    frame.flushes++;
+    lv_disp_flush_ready(disp);
+}
+
+static void host_monitor_cb(lv_disp_drv_t *disp, uint32_t time, uint32_t px)
+{
+    frame.px += px;
+}
+
+/**
+ * @brief Guarda el framebuffer como PPM binario (P6) de 8 bits por canal.
+ *
+ * @return false si no se pudo escribir el archivo.
+ */
+static bool host_dump_ppm(const char *dir, uint32_t n)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%05u.ppm", dir, n);
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", HOST_HOR_RES, HOST_VER_RES);
+    for (uint32_t i = 0; i < HOST_HOR_RES * HOST_VER_RES; i++) {
+        uint16_t c = framebuffer[i];
+        uint8_t rgb[3] = {
+            ((c >> 11) & 0x1F) * 255 / 31,
+            ((c >> 5) & 0x3F) * 255 / 63,
+            (c & 0x1F) * 255 / 31,
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+/**
+ * @brief Mide el costo de actualizar el label de la hora, el único con la fuente de 48 pt.
+ *
+ * Cambia el minuto en cada iteración y redibuja solo el area del label, como update_time().
+ * Compara el render con y sin el cache de sprites de glifos (LV_GLYPH_SPRITE_CACHE_SIZE).
+ *
+ * @param changes cambios de minuto a medir.
+ */
+static void host_time_bench(uint32_t changes)
+{
+    lv_obj_t *label_time = lv_obj_get_child(screen1, 0);
+    lv_glyph_sprite_stats_t sprites;
+    char time_str[8];
+    uint32_t total_us = 0;
+    uint32_t max_us = 0;
+
+    lv_refr_now(NULL);
+    lv_draw_letter_sprite_stats(&sprites, true);
+
+    for (uint32_t i = 0; i < changes; i++) {
+        snprintf(time_str, sizeof(time_str), "%.2u:%.2u", i / 60 % 24, i % 60);
+        lv_label_set_text(label_time, time_str);
+        lv_obj_align(label_time, LV_ALIGN_CENTER, 0, -70);
+
+        memset(&frame, 0, sizeof(frame));
+        uint32_t start_us = host_time_us();
+        lv_refr_now(NULL);
+        uint32_t us = host_time_us() - start_us;
+
+        total_us += us;
+        if (us > max_us) max_us = us;
+    }
+
+    lv_draw_letter_sprite_stats(&sprites, false);
+    fprintf(stderr, "time label: %u changes, %uus avg, %uus max, sprite cache %d: %u hits, %u misses, %u skips\n",
+            changes, changes ? total_us / changes : 0, max_us, LV_GLYPH_SPRITE_CACHE_SIZE,
+            sprites.hits, sprites.misses, sprites.skips);
+}
+
+/**
+ * @brief Mide el ancho de unos textos con lv_txt_get_width(), que busca el glifo y el kerning de cada
+ * letra igual que el render de un label.
+ *
+ * @param font fuente a medir.
+ * @param texts textos a medir en cada vuelta.
+ * @param count número de textos.
+ * @param rounds vueltas sobre todos los textos.
+ * @return tiempo promedio por letra en ns.
+ */
+static uint32_t host_glyph_time(const lv_font_t *font, const char *const *texts, uint32_t count, uint32_t rounds)
+{
+    volatile uint32_t width = 0;
+    uint64_t letters = 0;
+
+    uint32_t start_us = host_time_us();
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t t = 0; t < count; t++) {
+            uint32_t len = strlen(texts[t]);
+            width += lv_txt_get_width(texts[t], len, font, 0, LV_TEXT_FLAG_NONE);
+            letters += len;
+        }
+    }
+    uint32_t us = host_time_us() - start_us;
+    return letters ? (uint32_t)((uint64_t)us * 1000 / letters) : 0;
+}
+
+/**
+ * @brief Mide la busqueda de glifos y kerning de las fuentes de screens.c con textos como los de las pantallas.
+ *
+ * Los textos ASCII y los símbolos de la batería se miden por separado: solo los símbolos pasan por
+ * la busqueda binaria que guarda el cache de las fuentes (LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE). Con
+ * FONT_SUBSETS las fuentes son las recortadas y todos los caracteres están en sus listas.
+ *
+ * @param rounds vueltas sobre todos los textos.
+ */
+static void host_glyph_bench(uint32_t rounds)
+{
+    static const char *const texts_10[] = {"Steps: 1234", "70 bpm", "250cals", "740m"};
+    static const char *const texts_14[] = {"100%", "35%"};
+    static const char *const texts_18[] = {"01/01/2025 WED", "10/12/2024 SUN"};
+    static const char *const texts_48[] = {"15:45", "23:59"};
+    static const char *const symbols[] = {
+        LV_SYMBOL_BATTERY_FULL, LV_SYMBOL_BATTERY_2 LV_SYMBOL_BATTERY_EMPTY, LV_SYMBOL_BATTERY_3 LV_SYMBOL_BATTERY_1,
+    };
+    static const struct {
+        const lv_font_t *font;
+        const char *name;
+        const char *const *texts;
+        uint32_t count;
+        bool symbols;
+    } fonts[] = {
+        {FONT_UI_10, "montserrat_10", texts_10, sizeof(texts_10) / sizeof(texts_10[0]), false},
+        {FONT_UI_14, "montserrat_14", texts_14, sizeof(texts_14) / sizeof(texts_14[0]), true},
+        {FONT_UI_18, "montserrat_18", texts_18, sizeof(texts_18) / sizeof(texts_18[0]), false},
+        {FONT_UI_48, "montserrat_48", texts_48, sizeof(texts_48) / sizeof(texts_48[0]), false},
+    };
+
+    for (uint32_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        lv_font_fmt_txt_cache_stats_t stats;
+
+        lv_font_fmt_txt_cache_stats(fonts[f].font, &stats, true);
+        uint32_t text_ns = host_glyph_time(fonts[f].font, fonts[f].texts, fonts[f].count, rounds);
+        uint32_t symbol_ns = 0;
+        if (fonts[f].symbols) {
+            symbol_ns = host_glyph_time(fonts[f].font, symbols, sizeof(symbols) / sizeof(symbols[0]), rounds);
+        }
+        lv_font_fmt_txt_cache_stats(fonts[f].font, &stats, false);
+
+        fprintf(stderr, "%s%s: text %u ns/byte, ", fonts[f].name, FONT_SUBSETS ? "_subset" : "", text_ns);
+        if (fonts[f].symbols) fprintf(stderr, "symbols %u ns/byte, ", symbol_ns);
+        fprintf(stderr, "glyph cache %u hits %u misses, kern cache %u hits %u misses\n",
+                stats.glyph_hits, stats.glyph_misses, stats.kern_hits, stats.kern_misses);
+    }
+}
+
+/**
+ * @brief Suma el tiempo del dibujo del fondo y del indicador de un arco, entre los eventos
+ * LV_EVENT_DRAW_PART_BEGIN y LV_EVENT_DRAW_PART_END que rodean cada lv_draw_arc().
+ */
+static void host_arc_draw_cb(lv_event_t *e)
+{
+    lv_obj_draw_part_dsc_t *dsc = lv_event_get_param(e);
+    if (dsc->type != LV_ARC_DRAW_PART_BACKGROUND && dsc->type != LV_ARC_DRAW_PART_FOREGROUND) return;
+
+    if (lv_event_get_code(e) == LV_EVENT_DRAW_PART_BEGIN) arc_draw_start_ns = host_time_ns();
+    else arc_draw_ns += host_time_ns() - arc_draw_start_ns;
+}
+
+/**
+ * @brief Cambia el valor de unos arcos y mide el render de cada cambio.
+ *
+ * @param arcs arcos a cambiar, todos en la pantalla cargada.
+ * @param count número de arcos.
+ * @param changes cambios de valor a medir.
+ * @param name nombre del caso en el reporte.
+ */
+static void host_arc_time(lv_obj_t **arcs, uint32_t count, uint32_t changes, const char *name)
+{
+    lv_arc_ring_stats_t rings;
+    uint32_t total_us = 0;
+    uint32_t max_us = 0;
+
+    for (uint32_t a = 0; a < count; a++) {
+        lv_obj_add_event_cb(arcs[a], host_arc_draw_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+        lv_obj_add_event_cb(arcs[a], host_arc_draw_cb, LV_EVENT_DRAW_PART_END, NULL);
+    }
+    lv_refr_now(NULL);
+    lv_draw_arc_ring_stats(&rings, true);
+    arc_draw_ns = 0;
+
+    for (uint32_t i = 0; i < changes; i++) {
+        // Sube y baja entre 0 y 100 para cubrir todos los angulos
+        int16_t value = (i / 100) % 2 ? 100 - i % 100 : i % 100;
+        // Todo el arco, no solo los angulos que cambian, para medir el dibujo del anillo completo
+        for (uint32_t a = 0; a < count; a++) {
+            lv_arc_set_value(arcs[a], value);
+            lv_obj_invalidate(arcs[a]);
+        }
+
+        uint32_t start_us = host_time_us();
+        lv_refr_now(NULL);
+        uint32_t us = host_time_us() - start_us;
+
+        total_us += us;
+        if (us > max_us) max_us = us;
+    }
+
+    lv_draw_arc_ring_stats(&rings, false);
+    fprintf(stderr, "%s: %u changes, %uus avg, %uus max, lv_draw_arc %uus avg, ring cache %d: %u hits, %u misses, %u skips\n",
+            name, changes, changes ? total_us / changes : 0, max_us,
+            changes ? (uint32_t)(arc_draw_ns / 1000 / changes) : 0, LV_ARC_RING_CACHE_SIZE,
+            rings.hits, rings.misses, rings.skips);
+}
+
+/**
+ * @brief Mide el costo de cambiar el valor de los arcos: los dos de 45x45 de la pantalla principal
+ * y un anillo de actividad de 240 px en una pantalla aparte.
+ *
+ * Compara el render con y sin el cache de anillos (LV_ARC_RING_CACHE_SIZE).
+ *
+ * @param changes cambios de valor a medir en cada caso.
+ * @param dump_dir carpeta donde guardar el último cuadro de cada caso, NULL para no guardarlos.
+ * @return false si no se pudo guardar un cuadro.
+ */
+static bool host_arc_bench(uint32_t changes, const char *dump_dir)
+{
+    lv_obj_t *arcs[2];
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(screen1) && count < 2; i++) {
+        lv_obj_t *child = lv_obj_get_child(screen1, i);
+        if (lv_obj_check_type(child, &lv_arc_class)) arcs[count++] = child;
+    }
+    host_arc_time(arcs, count, changes, "arcs 45x45");
+    if (dump_dir && !host_dump_ppm(dump_dir, 0)) return false;
+
+    // El anillo alrededor de toda la pantalla redonda, configurado como los arcos de screens.c
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+    lv_obj_t *ring = lv_arc_create(screen);
+    lv_obj_set_size(ring, HOST_HOR_RES, HOST_VER_RES);
+    lv_arc_set_rotation(ring, 270);
+    lv_arc_set_bg_angles(ring, 0, 360);
+    lv_obj_remove_style(ring, NULL, LV_PART_KNOB);
+    lv_obj_center(ring);
+    lv_scr_load(screen);
+
+    host_arc_time(&ring, 1, changes, "ring 240");
+    return !dump_dir || host_dump_ppm(dump_dir, 1);
+}
+
+static void host_display_init(void)
+{
+    lv_init();
+
+    lv_disp_draw_buf_init(&disp_buf, buf0, buf1, HOST_HOR_RES * HOST_STRIP_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.flush_cb = host_flush_cb;
+    disp_drv.monitor_cb = host_monitor_cb;
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.hor_res = HOST_HOR_RES;
+    disp_drv.ver_res = HOST_VER_RES;
+    // Igual que el firmware con DISP_ROUND: no se renderizan los pixeles fuera del circulo
+    disp_drv.circle_clip = 1;
+    lv_disp_drv_register(&disp_drv);
+
+    host_round_init();
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = HOST_FRAMES;
+    uint32_t dump_every = 0;
+    uint32_t dumps[HOST_MAX_DUMPS];
+    uint8_t dump_count = 0;
+    uint32_t time_changes = 0;
+    uint32_t glyph_rounds = 0;
+    uint32_t arc_changes = 0;
+    const char *dump_dir = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:o:e:f:t:g:a:")) != -1) {
+        switch (opt) {
+            case 'n': frames = strtoul(optarg, NULL, 0); break;
+            case 'o': dump_dir = optarg; break;
+            case 'e': dump_every = strtoul(optarg, NULL, 0); break;
+            case 'f':
+                if (dump_count < HOST_MAX_DUMPS) dumps[dump_count++] = strtoul(optarg, NULL, 0);
+                break;
+            case 't': time_changes = strtoul(optarg, NULL, 0); break;
+            case 'g': glyph_rounds = strtoul(optarg, NULL, 0); break;
+            case 'a': arc_changes = strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "uso: %s [-n cuadros] [-o carpeta] [-e cada] [-f cuadro] [-t cambios] [-g vueltas] [-a cambios]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    host_display_init();
+    create_screen1();
+    lv_scr_load(screen1);
+
+    if (glyph_rounds) {
+        host_glyph_bench(glyph_rounds);
+        return 0;
+    }
+    if (arc_changes) return host_arc_bench(arc_changes, dump_dir) ? 0 : 1;
+    if (time_changes) {
+        host_time_bench(time_changes);
+        if (dump_dir && !host_dump_ppm(dump_dir, time_changes)) return 1;
+        return 0;
+    }
+
+    datetime_t now;
+    uint32_t steps = 0;
+    uint8_t bpm = 70;
+    uint32_t beat_ms = 0;
+    host_frame_t total = {0};
+    uint32_t rendered = 0;
+    uint32_t max_us = 0;
+
+    printf("frame,sim_ms,render_us,px,flushes,flush_bytes,round_bytes\n");
+    for (uint32_t n = 0; n < frames; n++) {
+        uint32_t sim_ms = n * HOST_FRAME_MS;
+
+        // Mismos periodos que las banderas de los timers del bucle principal de lib.c, y el pulso
+        // en cada latido como lo actualiza lib.c al detectarlo
+        host_hw_set_time_ms(sim_ms);
+        if (sim_ms % 500 == 0) {
+            update_steps(&steps, 0);
+            update_battery();
+            update_distance(steps);
+            update_calories(steps, bpm);
+        }
+        if (sim_ms % 1000 == 0) update_time(&now);
+        if (sim_ms >= beat_ms) {
+            bpm = host_hw_bpm();
+            update_hr(bpm);
+            beat_ms += 60000 / bpm;
+        }
+
+        memset(&frame, 0, sizeof(frame));
+        uint32_t start_us = host_time_us();
+        lv_timer_handler();
+        frame.render_us = host_time_us() - start_us;
+        lv_tick_inc(HOST_FRAME_MS);
+
+        printf("%u,%u,%u,%u,%u,%u,%u\n", n, sim_ms, frame.render_us, frame.px,
+               frame.flushes, frame.flush_bytes, frame.round_bytes);
+
+        if (frame.flushes) {
+            rendered++;
+            total.render_us += frame.render_us;
+            total.px += frame.px;
+            total.flushes += frame.flushes;
+            total.flush_bytes += frame.flush_bytes;
+            total.round_bytes += frame.round_bytes;
+            if (frame.render_us > max_us) max_us = frame.render_us;
+        }
+
+        bool dump = dump_every && n % dump_every == 0;
+        for (uint8_t i = 0; i < dump_count; i++) dump |= dumps[i] == n;
+        if (dump_dir && dump && !host_dump_ppm(dump_dir, n)) return 1;
+    }
+
+    fprintf(stderr, "frames: %u, rendered: %u, render: %uus total, %uus avg, %uus max\n",
+            frames, rendered, total.render_us, rendered ? total.render_us / rendered : 0, max_us);
+    fprintf(stderr, "px: %u, flushes: %u, flush bytes: %u, round clip bytes: %u\n",
+            total.px, total.flushes, total.flush_bytes, total.round_bytes);
+
+    pulse_stats_t pulse;
+    get_pulse_stats(&pulse, false);
+    fprintf(stderr, "pulse (%s): %u steps, %uus anim, %u draws, %uus draw, %uus/step\n",
+            PULSE_SPRITE ? "sprite" : "styles", pulse.steps, pulse.anim_us, pulse.draws, pulse.draw_us,
+            pulse.steps ? (pulse.anim_us + pulse.draw_us) / pulse.steps : 0);
+
+    lv_mem_buf_arena_stats_t arena;
+    lv_mem_monitor_t mon;
+    lv_mem_buf_arena_stats(&arena, false);
+    lv_mem_monitor(&mon);
+    fprintf(stderr, "draw arena: %u bytes, %u high water, %u fallbacks; heap: %u bytes used, %u free blocks, %u%% frag\n",
+            arena.size, arena.high_water, arena.fallbacks, mon.total_size - mon.free_size, mon.free_cnt, mon.frag_pct);
+    return 0;
+}
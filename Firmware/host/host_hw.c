@@ -0,0 +1,79 @@
+/**
+ * @file host_hw.c
+ *
+ * @brief Implementación de los sensores, RTC y ADC simulados del backend del PC.
+ *
+ * @see host_hw.h
+ */
+
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "host_hw.h"
+
+/*! @brief Bytes de RAM del DS1302*/
+#define HOST_RTC_RAM 31
+
+static uint32_t sim_ms;
+
+// Peso 70 kg, altura 170 cm y edad 25 años, como los configura el usuario en el reloj
+static uint8_t rtc_ram[HOST_RTC_RAM] = {[1] = 70, [2] = 170, [3] = 25};
+
+void host_hw_set_time_ms(uint32_t ms) {
+    sim_ms = ms;
+}
+
+uint8_t host_hw_bpm(void) {
+    return 70 + (sim_ms / 1500) % 30;
+}
+
+uint32_t time_us_32(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+uint64_t host_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+void GetDateTime(datetime_t* dt) {
+    // 01/01/2025 23:59:00, miércoles, igual que el datetime_t t de lib.c
+    uint32_t sec = 23 * 3600 + 59 * 60 + sim_ms / 1000;
+    uint32_t days = sec / 86400;
+
+    sec %= 86400;
+    dt->year = 2025;
+    dt->month = 1;
+    dt->day = 1 + days;
+    dt->dotw = (3 + days) % 7;
+    dt->hour = sec / 3600;
+    dt->min = sec / 60 % 60;
+    dt->sec = sec % 60;
+}
+
+void SetMemory(uint8_t memoryAddress, uint8_t value) {
+    if (memoryAddress < HOST_RTC_RAM) rtc_ram[memoryAddress] = value;
+}
+
+uint8_t GetMemory(uint8_t memoryAddress) {
+    return memoryAddress < HOST_RTC_RAM ? rtc_ram[memoryAddress] : 0;
+}
+
+uint32_t read_imu_step_count(void) {
+    return sim_ms / 600;
+}
+
+uint16_t adc_read(void) {
+    // 4 V en el divisor por 2 con referencia de 3.3 V y 12 bits
+    uint32_t drop = sim_ms / 1000;
+    return drop < 2482 ? 2482 - drop : 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file host_hw.h
+ *
+ * @brief Sensores, RTC y ADC simulados para compilar las pantallas en el PC.
+ *
+ * Reemplaza las funciones de ds1302.h, imu.h y hardware/adc.h que usan las funciones
+ * update_* de screens.c. Los valores dependen solo del tiempo simulado, así dos corridas
+ * con los mismos parametros renderizan los mismos cuadros.
+ *
+ * @see host_hw.c
+ * @see host_display.c
+ */
+
+#ifndef HOST_HW_H
+#define HOST_HW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Fecha y hora, mismos campos que el datetime_t del SDK de la pico.
+ */
+typedef struct
+{
+    int16_t year;   /**< 0..4095*/
+    int8_t month;   /**< 1..12*/
+    int8_t day;     /**< 1..31*/
+    int8_t dotw;    /**< 0..6, 0 es domingo*/
+    int8_t hour;    /**< 0..23*/
+    int8_t min;     /**< 0..59*/
+    int8_t sec;     /**< 0..59*/
+} datetime_t;
+
+/**
+ * @brief Fija el tiempo simulado del que dependen todos los valores de los sensores.
+ *
+ * @param ms milisegundos desde el arranque.
+ */
+void host_hw_set_time_ms(uint32_t ms);
+
+/**
+ * @brief Pulso simulado, cambia cada 1.5 s.
+ *
+ * @return pulso en latidos por minuto.
+ */
+uint8_t host_hw_bpm(void);
+
+/**
+ * @brief Tiempo real desde un punto fijo, como time_us_32() del SDK de la pico. No es el tiempo
+ * simulado, sirve para medir el render en el PC.
+ *
+ * @return microsegundos.
+ */
+uint32_t time_us_32(void);
+
+/**
+ * @brief Contador de ciclos del procesador del PC (rdtsc en x86, nanosegundos en otras arquitecturas),
+ * para medir funciones que toman menos de un microsegundo.
+ *
+ * @return ciclos.
+ */
+uint64_t host_cycles(void);
+
+/** @brief Hora del RTC, empieza en la fecha por defecto de lib.c*/
+void GetDateTime(datetime_t* dt);
+/** @brief Escribe un byte de la RAM del RTC*/
+void SetMemory(uint8_t memoryAddress, uint8_t value);
+/** @brief Lee un byte de la RAM del RTC, peso, altura y edad en las direcciones 1, 2 y 3*/
+uint8_t GetMemory(uint8_t memoryAddress);
+/** @brief Pasos del podómetro de la IMU, una caminata de unos 100 pasos por minuto*/
+uint32_t read_imu_step_count(void);
+/** @brief Lectura del ADC de la batería, se descarga despacio desde 4 V*/
+uint16_t adc_read(void);
+
+#endif
@@ -0,0 +1,263 @@
+/**
+ * @file pulse_host.c
+ *
+ * @brief Banco de pruebas en el PC del procesamiento de la señal del MAX30102 (pulse_read.c).
+ *
+ * Alimenta el detector de pulso con una señal de IR simulada, con la forma de un PPG, deriva de
+ * la línea base y ruido, y mide los ciclos por muestra de add_sample_at() con la lectura del
+ * latido, los latidos detectados y el error del pulso de cada latido. La señal es determinística,
+ * dos corridas con los mismos parametros dan los mismos pulsos.
+ *
+ * También mide los ciclos por muestra de cada filtro de filters.h sobre la misma señal, muestra
+ * por muestra y en bloques de PULSE_BLOCK como se filtra una FIFO del sensor.
+ *
+ * Después repite la señal quitando el dedo a la mitad por -l segundos y poniéndolo de nuevo con
+ * el pulso de -r: reporta si calculate_heart_rate() da el pulso perdido y el error de los primeros
+ * PULSE_BEAT_AVG pulsos al volver, que no deben promediar intervalos de antes de quitarlo.
+ *
+ *     ./build_host/pulse_host -s 60 -b 72 -w 200 -l 3 -r 110
+ *
+ * @see pulse_read.c
+ * @see host_hw.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "../include/pulse_read.h"
+
+/*! @brief Muestras por segundo del MAX30102: 400 Hz promediados de a 8*/
+#define HOST_PULSE_RATE 50
+/*! @brief Nivel DC del IR con el dedo puesto, rango de 4096 nA y 18 bits*/
+#define HOST_PULSE_DC 120000
+/*! @brief Amplitud de la componente pulsátil*/
+#define HOST_PULSE_AC 1500
+
+/*! @brief Nivel del IR sin el dedo, solo la luz ambiente*/
+#define HOST_PULSE_AMBIENT 800
+
+/*! @brief Muestras del promedio móvil medido, las del suavizado que usaba el detector*/
+#define HOST_PULSE_SMOOTH 15
+
+static uint32_t noise_state = 1;
+
+/**
+ * @brief Ruido uniforme reproducible (generador congruencial lineal).
+ *
+ * @return valor entre -amp y amp.
+ */
+static int32_t host_noise(int32_t amp) {
+    noise_state = noise_state * 1664525u + 1013904223u;
+    return (int32_t)(noise_state >> 16) % (2 * amp + 1) - amp;
+}
+
+/**
+ * @brief Muestra de IR simulada: subida rápida, bajada lenta con muesca dicrótica, respiración y ruido.
+ *
+ * El IR baja cuando llega la sangre, por eso el pulso se resta del nivel DC.
+ *
+ * @param t_ms tiempo de la muestra en ms.
+ * @param bpm pulso simulado.
+ * @return muestra de 18 bits.
+ */
+static uint32_t host_ppg(uint32_t t_ms, uint32_t bpm) {
+    double phase = fmod(t_ms * bpm / 60000.0, 1.0);
+    double pulse = phase < 0.15 ? sin(phase / 0.15 * M_PI / 2)
+                                : exp(-(phase - 0.15) * 4) + 0.15 * exp(-pow((phase - 0.45) / 0.05, 2));
+    double breath = 400 * sin(2 * M_PI * t_ms / 4000.0);
+
+    return (uint32_t)(HOST_PULSE_DC + breath - HOST_PULSE_AC * pulse + host_noise(60));
+}
+
+/*! @brief Un filtro de filters.h con el mismo estado para las dos formas de llamarlo*/
+typedef enum {
+    HOST_FILTER_MA,
+    HOST_FILTER_DC,
+    HOST_FILTER_FIR,
+    HOST_FILTER_BIQUAD,
+    HOST_FILTERS
+} host_filter_t;
+
+/**
+ * @brief Inicializa un filtro como lo usa el procesamiento del pulso.
+ *
+ * @param id filtro.
+ * @param ma, dc, fir, biquad estados de los filtros.
+ * @param ma_buf memoria del promedio móvil.
+ */
+static void host_filter_init(host_filter_t id, filter_ma_t *ma, filter_dc_t *dc, filter_fir_t *fir,
+                             filter_biquad_t *biquad, int32_t *ma_buf) {
+    switch (id) {
+        case HOST_FILTER_MA: filter_ma_init(ma, ma_buf, HOST_PULSE_SMOOTH); break;
+        case HOST_FILTER_DC: filter_dc_init(dc, 4); break;
+        case HOST_FILTER_FIR: filter_fir_init(fir, pulse_fir_coefs, PULSE_FIR_HALF); break;
+        default: filter_biquad_init(biquad, pulse_bandpass_coefs); break;
+    }
+}
+
+/**
+ * @brief Mide los ciclos por muestra de cada filtro, una muestra por llamada y en bloques.
+ *
+ * El promedio móvil y la remoción de DC reciben la señal de IR, el FIR y el biquad la señal sin DC
+ * como en el procesamiento del pulso.
+ *
+ * @param ir señal de IR.
+ * @param samples número de muestras.
+ */
+static void host_filter_bench(const uint32_t *ir, uint32_t samples) {
+    static const char *names[HOST_FILTERS] = {"moving average", "dc removal", "fir", "biquad"};
+    int32_t *raw = malloc(samples * sizeof(int32_t));
+    int32_t *ac = malloc(samples * sizeof(int32_t));
+    int32_t *out = malloc(samples * sizeof(int32_t));
+    if (raw == NULL || ac == NULL || out == NULL) return;
+
+    filter_ma_t ma;
+    filter_dc_t dc;
+    filter_fir_t fir;
+    filter_biquad_t biquad;
+    int32_t ma_buf[HOST_PULSE_SMOOTH];
+
+    for (uint32_t n = 0; n < samples; n++) raw[n] = ir[n];
+    filter_dc_init(&dc, 4);
+    filter_dc_block(&dc, raw, ac, samples);
+
+    for (host_filter_t id = 0; id < HOST_FILTERS; id++) {
+        const int32_t *in = id == HOST_FILTER_MA || id == HOST_FILTER_DC ? raw : ac;
+        uint64_t cycles[2];
+
+        for (uint8_t blocks = 0; blocks < 2; blocks++) {
+            host_filter_init(id, &ma, &dc, &fir, &biquad, ma_buf);
+            uint32_t step = blocks ? PULSE_BLOCK : 1;
+            uint64_t start = host_cycles();
+            for (uint32_t n = 0; n < samples; n += step) {
+                uint16_t len = samples - n < step ? samples - n : step;
+                if (blocks) {
+                    switch (id) {
+                        case HOST_FILTER_MA: filter_ma_block(&ma, in + n, out + n, len); break;
+                        case HOST_FILTER_DC: filter_dc_block(&dc, in + n, out + n, len); break;
+                        case HOST_FILTER_FIR: filter_fir_block(&fir, in + n, out + n, len); break;
+                        default: filter_biquad_block(&biquad, in + n, out + n, len); break;
+                    }
+                }
+                else {
+                    switch (id) {
+                        case HOST_FILTER_MA: out[n] = filter_ma(&ma, in[n]); break;
+                        case HOST_FILTER_DC: out[n] = filter_dc(&dc, in[n]); break;
+                        case HOST_FILTER_FIR: out[n] = filter_fir(&fir, in[n]); break;
+                        default: out[n] = filter_biquad(&biquad, in[n]); break;
+                    }
+                }
+            }
+            cycles[blocks] = host_cycles() - start;
+        }
+        fprintf(stderr, "%s: %llu cycles/sample, %llu in blocks of %u\n", names[id],
+                (unsigned long long)(cycles[0] / samples), (unsigned long long)(cycles[1] / samples), PULSE_BLOCK);
+    }
+    free(raw);
+    free(ac);
+    free(out);
+}
+
+/**
+ * @brief Quita el dedo a la mitad de la señal y lo pone de nuevo con otro pulso.
+ *
+ * @param seconds segundos de señal.
+ * @param bpm pulso antes de quitar el dedo.
+ * @param lift_s segundos sin el dedo.
+ * @param bpm_after pulso al ponerlo de nuevo.
+ */
+static void host_lift_bench(uint32_t seconds, uint32_t bpm, uint32_t lift_s, uint32_t bpm_after) {
+    uint32_t lift_ms = seconds * 1000 / 2;
+    uint32_t back_ms = lift_ms + lift_s * 1000;
+    uint32_t lost_ms = 0, first_ms = 0, updates = 0, bpm_err = 0;
+
+    for (uint32_t n = 0; n < seconds * HOST_PULSE_RATE; n++) {
+        uint32_t t_ms = n * 1000 / HOST_PULSE_RATE;
+        uint32_t sample = t_ms < lift_ms   ? host_ppg(t_ms, bpm)
+                          : t_ms < back_ms ? (uint32_t)(HOST_PULSE_AMBIENT + host_noise(60))
+                                           : host_ppg(t_ms, bpm_after);
+        pulse_beat_t beat;
+
+        add_sample_at(sample, t_ms);
+        if (t_ms >= lift_ms && lost_ms == 0 && calculate_heart_rate() == PULSE_LOST) lost_ms = t_ms - lift_ms;
+        if (pulse_get_beat(&beat) && beat.timestamp >= back_ms && updates < PULSE_BEAT_AVG) {
+            if (updates++ == 0) first_ms = beat.timestamp - back_ms;
+            bpm_err += abs((int)beat.bpm - (int)bpm_after);
+        }
+    }
+
+    if (lost_ms) fprintf(stderr, "lift: %us at %ums, pulse lost after %ums", lift_s, lift_ms, lost_ms);
+    else fprintf(stderr, "lift: %us at %ums, pulse never lost", lift_s, lift_ms);
+    fprintf(stderr, ", back at %u bpm: first bpm after %ums, %u bpm avg error over the first %u updates\n",
+            bpm_after, first_ms, updates ? bpm_err / updates : 0, updates);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = 60;
+    uint32_t bpm = 72;
+    uint32_t lift_s = 3;
+    uint32_t bpm_after = 110;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:b:w:l:r:")) != -1) {
+        switch (opt) {
+            case 's': seconds = strtoul(optarg, NULL, 0); break;
+            case 'b': bpm = strtoul(optarg, NULL, 0); break;
+            case 'w': detect.window_size = strtoul(optarg, NULL, 0); break;
+            case 'l': lift_s = strtoul(optarg, NULL, 0); break;
+            case 'r': bpm_after = strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "uso: %s [-s segundos] [-b pulso] [-w ventana] [-l segundos sin dedo] [-r pulso al volver]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (detect.window_size == 0 || detect.window_size > MAX_WINDOW) {
+        fprintf(stderr, "la ventana debe ser de 1 a %u muestras (PULSE_RING_BITS)\n", MAX_WINDOW);
+        return 1;
+    }
+    // Estado inicial del detector para la segunda corrida
+    beat_detector_t initial = detect;
+
+    // La señal se genera antes para que sus funciones de math.h no se midan
+    uint32_t samples = seconds * HOST_PULSE_RATE;
+    uint32_t *ir = malloc(samples * sizeof(uint32_t));
+    if (ir == NULL) return 1;
+    for (uint32_t n = 0; n < samples; n++) ir[n] = host_ppg(n * 1000 / HOST_PULSE_RATE, bpm);
+
+    uint64_t add_cycles = 0;
+    uint32_t updates = 0, bpm_err = 0, first_ms = 0;
+
+    // Como en lib.c el pulso se lee después de cada muestra, las de un bloque se miden juntas
+    for (uint32_t n = 0; n < samples; n += PULSE_BLOCK) {
+        uint32_t end = n + PULSE_BLOCK < samples ? n + PULSE_BLOCK : samples;
+        pulse_beat_t beats[PULSE_BLOCK];
+        uint8_t reads = 0;
+
+        uint64_t start = host_cycles();
+        for (uint32_t i = n; i < end; i++) {
+            add_sample_at(ir[i], i * 1000 / HOST_PULSE_RATE);
+            if (pulse_get_beat(&beats[reads])) reads++;
+        }
+        add_cycles += host_cycles() - start;
+
+        for (uint8_t i = 0; i < reads; i++) {
+            if (updates++ == 0) first_ms = beats[i].timestamp;
+            bpm_err += abs((int)beats[i].bpm - (int)bpm);
+        }
+    }
+
+    fprintf(stderr, "pulse: %u samples, window %u of %u, add_sample + beat %llu cycles/sample\n",
+            samples, detect.window_size, MAX_WINDOW, (unsigned long long)(add_cycles / samples));
+    fprintf(stderr, "beats: %u detected, %u simulated, %u bpm updates, first at %ums, %u bpm avg error (%u bpm simulated)\n",
+            detect.beats, seconds * bpm / 60, updates, first_ms, updates ? bpm_err / updates : 0, bpm);
+
+    host_filter_bench(ir, samples);
+    free(ir);
+
+    detect = initial;
+    host_lift_bench(seconds, bpm, lift_s, bpm_after);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file dma_gpu.h
+ *
+ * @brief Archivo con la definición de funciones de la "GPU" por DMA del buffer de dibujo.
+ *
+ * Rellenos de un color y copias de rectangulos RGB565 dentro de la RAM hechos con canales de
+ * DMA libres, para que la CPU siga dibujando mientras tanto. Cada core que renderiza tiene su
+ * par de canales: uno de datos y uno de control que le carga un @ref dma_gpu_block_t por fila.
+ *
+ * Las funciones trabajan con los canales del core que las llama, así el core 1 puede rellenar
+ * su banda sin esperar los trabajos del core 0.
+ *
+ * @see dma_gpu.c
+ * @see pio_lcd_driver.h
+ */
+
+#ifndef dma_gpu_H
+#define dma_gpu_H
+
+#include "stdio.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+
+/**
+ * @addtogroup DMA_GPU_CONFIG
+ *
+ * @{
+ *
+ * Configuración de la GPU por DMA.
+ */
+/*! @brief Cores que pueden usar la GPU por DMA, cada uno reclama dos canales*/
+#define DMA_GPU_MAX_CORES 2
+
+/*! @brief Filas que el DMA hace por trabajo, las que sobran las hace la CPU mientras el DMA trabaja.
+ *
+ * Cada fila es un bloque de control de 16 bytes por core. */
+#ifndef DMA_GPU_MAX_ROWS
+#define DMA_GPU_MAX_ROWS 48
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @brief Bloque de control del DMA, se escribe en los registros alias 1 del canal de datos.
+ *
+ * Escribir @c count dispara el canal de datos, un bloque con @c count en 0 termina el trabajo.
+ */
+typedef struct
+{
+    uint32_t ctrl;              /**< Registro CTRL del canal de datos*/
+    const volatile void *read;  /**< Dirección de lectura, el color del relleno o la fila de origen*/
+    volatile void *write;       /**< Dirección de escritura, la fila de destino*/
+    uint32_t count;             /**< Transferencias, dispara el canal*/
+} dma_gpu_block_t;
+
+/**
+ * @brief Estadisticas de la GPU por DMA, sumadas entre los cores.
+ */
+typedef struct
+{
+    uint32_t jobs;      /**< Rellenos y copias hechos con el DMA*/
+    uint32_t px;        /**< Pixeles escritos por el DMA*/
+    uint32_t cpu_px;    /**< Pixeles de las filas que no cupieron en @ref DMA_GPU_MAX_ROWS, hechos por la CPU*/
+    uint32_t waits;     /**< Esperas que encontraron el DMA ocupado*/
+    uint32_t wait_us;   /**< Tiempo en us esperando al DMA*/
+} dma_gpu_stats_t;
+
+/**
+ * @addtogroup DMA_GPU_FUNCTIONS
+ *
+ * @{
+ *
+ * Funciones de la GPU por DMA.
+ */
+
+/**
+ * @brief Reclama los canales de datos y de control de cada core.
+ *
+ * @param cores Cores que van a usar la GPU, hasta @ref DMA_GPU_MAX_CORES.
+ */
+void DMA_GPU_init(uint8_t cores);
+
+/**
+ * @brief Empieza a rellenar un rectangulo con un color y retorna sin esperar.
+ *
+ * Espera antes el trabajo anterior del mismo core.
+ *
+ * @param dest Primer pixel del rectangulo.
+ * @param dest_stride Pixeles por fila del buffer de destino.
+ * @param width Ancho del rectangulo.
+ * @param height Alto del rectangulo.
+ * @param color Color RGB565 en el formato del buffer.
+ */
+void DMA_GPU_Fill(uint16_t *dest, uint16_t dest_stride, uint16_t width, uint16_t height, uint16_t color);
+
+/**
+ * @brief Empieza a copiar un rectangulo y retorna sin esperar.
+ *
+ * Espera antes el trabajo anterior del mismo core. El origen debe mantenerse valido hasta
+ * @see DMA_GPU_Wait.
+ *
+ * @param dest Primer pixel del rectangulo de destino.
+ * @param dest_stride Pixeles por fila del buffer de destino.
+ * @param src Primer pixel del rectangulo de origen.
+ * @param src_stride Pixeles por fila del buffer de origen.
+ * @param width Ancho del rectangulo.
+ * @param height Alto del rectangulo.
+ */
+void DMA_GPU_Copy(uint16_t *dest, uint16_t dest_stride, const uint16_t *src, uint16_t src_stride,
+                  uint16_t width, uint16_t height);
+
+/**
+ * @brief Indica si el trabajo del core que llama sigue en curso.
+ *
+ * @return true si el DMA no ha terminado.
+ */
+bool DMA_GPU_Busy(void);
+
+/**
+ * @brief Espera a que termine el trabajo del core que llama.
+ */
+void DMA_GPU_Wait(void);
+
+/**
+ * @brief Lee las estadisticas de la GPU por DMA.
+ *
+ * @param stats Estructura donde se copian.
+ * @param reset true para ponerlas en cero después de leerlas.
+ */
+void DMA_GPU_GetStats(dma_gpu_stats_t *stats, bool reset);
+
+/**
+ * @}
+ */
+
+#endif
@@ -49,6 +49,18 @@
 /*! @brief Pin de INT del sensor de pulso*/
 #define MAX_INT 5
 
+/*! @brief Bytes máximos de una lectura por DMA, la FIFO llena del MAX30102 (32 muestras de 6 bytes)*/
+#define I2C_DMA_MAX_LEN 192
+
+/**
+ * @brief Función que se llama desde la interrupción del DMA al terminar una lectura.
+ *
+ * @param pData bytes leídos.
+ * @param len cantidad de bytes.
+ * @param ok false si el dispositivo no respondió y los bytes no son válidos.
+ */
+typedef void (*i2c_dma_callback_t)(uint8_t *pData, uint32_t len, bool ok);
+
 // espacio para las instrucciones de preprocesador del rtc
 
 
@@ -128,6 +140,36 @@ uint8_t i2c_read_byte (i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg);
 */
 void i2c_read_nbytes (i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t len);
 
+/**
+ * @brief Lee varios bytes de un registro en una sola transacción por DMA, sin esperar.
+ * 
+ * Un canal de DMA escribe en el I2C el registro y los comandos de lectura y otro copia los
+ * bytes recibidos a pData. El bus queda ocupado hasta que termina: las demás funciones de este
+ * driver esperan a que termine antes de empezar.
+ * 
+ * @param i2c_port Puerto I2C.
+ * @param addr Dirección del dispositivo.
+ * @param reg Registro del dispositivo.
+ * @param pData puntero donde se guardan los valores leidos, debe existir hasta el callback.
+ * @param len Cantidad de bytes a leer, hasta I2C_DMA_MAX_LEN.
+ * @param done función que se llama al terminar, desde la interrupción del DMA.
+ * 
+ * @return false si ya hay una lectura por DMA en curso o len no es válido.
+ * 
+*/
+bool i2c_read_nbytes_dma (i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t len, i2c_dma_callback_t done);
+
+/**
+ * @brief Indica si hay una lectura por DMA en curso.
+ * 
+ * Una interrupción no debe usar el bus mientras tanto: las funciones bloqueantes esperarían a la
+ * interrupción del DMA, que no puede entrar.
+ * 
+ * @return true si el bus está ocupado por el DMA.
+ * 
+*/
+bool i2c_dma_busy (void);
+
 /**
  * @}
  * 
@@ -0,0 +1,131 @@
+/**
+ * @file pio_lcd_driver.h
+ *
+ * @brief Archivo con la definición de funciones del transporte del LCD por PIO.
+ *
+ * Alternativa a @see spi_driver.h para el LCD: una maquina de estados del PIO genera
+ * SCK, MOSI y también el pin DC, que viaja en el mismo flujo de datos. Así los comandos
+ * y los pixeles de toda la cola del LCD salen en un solo flujo de DMA encadenado por
+ * bloques de control, sin esperar a que el SPI se vacie para cambiar DC.
+ *
+ * Se selecciona al compilar con @ref LCD_PIO, el SPI0 del RTC y el PWM del brillo
+ * siguen en spi_driver.c.
+ *
+ * @see pio_lcd_driver.c
+ * @see lcd_pio.pio
+ * @see LCD.c
+ */
+
+#ifndef pio_lcd_driver_H
+#define pio_lcd_driver_H
+
+#include "stdio.h"
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "spi_driver.h"
+
+/**
+ * @addtogroup PIO_LCD_CONFIG
+ *
+ * @{
+ *
+ * Configuración del transporte del LCD por PIO.
+ */
+/*! @brief Bloque PIO usado por el LCD*/
+#define LCD_PIO_INST pio0
+
+/*! @brief Divisor del reloj de la maquina de estados, SCK = clk_sys / (2 * LCD_PIO_CLKDIV).
+ *
+ * Con 1 y clk_sys a 270 MHz el SCK es 135 MHz, lo mismo que el SPI1 que queda limitado a
+ * clk_peri / 2 aunque se pidan 270 MHz. Subirlo si el panel muestra errores. */
+#ifndef LCD_PIO_CLKDIV
+#define LCD_PIO_CLKDIV 1.0f
+#endif
+
+/*! @brief Cabecera de un bloque del flujo del PIO: nivel de DC, bits por palabra y número de palabras*/
+#define PIO_LCD_HEADER(dc, bits, words) \
+    (((uint32_t)(dc) << 31) | ((uint32_t)((bits) - 1) << 26) | ((uint32_t)(words) - 1))
+/**
+ * @}
+ */
+
+/**
+ * @brief Bloque de control del DMA, se escribe en los registros alias 1 del canal de datos.
+ *
+ * Escribir @c count dispara el canal de datos, un bloque con @c count en 0 termina el flujo
+ * y genera la interrupción del canal.
+ */
+typedef struct
+{
+    uint32_t ctrl;              /**< Registro CTRL del canal de datos*/
+    const volatile void *read;  /**< Dirección de lectura*/
+    volatile void *write;       /**< Dirección de escritura, la FIFO TX del PIO*/
+    uint32_t count;             /**< Transferencias, dispara el canal*/
+} pio_lcd_block_t;
+
+/**
+ * @addtogroup PIO_LCD_FUNCTIONS
+ *
+ * @{
+ *
+ * Funciones del transporte del LCD por PIO.
+ */
+
+/**
+ * @brief Función que inicializa el transporte por PIO del LCD.
+ *
+ * Configura los pines del display y el PWM del brillo, carga el programa en el PIO y
+ * reclama los canales de DMA de datos (@c dma_tx) y de control.
+ */
+void PIO_LCD_init(void);
+
+/**
+ * @brief Envia un bloque de bytes con el nivel de DC dado y espera a que salga todo.
+ *
+ * Usada por los comandos bloqueantes de la inicialización del LCD.
+ *
+ * @param dc Nivel del pin DC, 0 comando, 1 dato.
+ * @param pData Bytes a enviar.
+ * @param Len Número de bytes.
+ */
+void PIO_LCD_Write(uint8_t dc, const uint8_t *pData, uint32_t Len);
+
+/**
+ * @brief Espera a que la maquina de estados envie todo lo que hay en la FIFO.
+ */
+void PIO_LCD_WaitIdle(void);
+
+/**
+ * @brief Llena un bloque de control del flujo del DMA.
+ *
+ * @param blk Bloque a llenar.
+ * @param data Datos a leer, 8, 16 o 32 bits por transferencia.
+ * @param count Número de transferencias.
+ * @param size Tamaño de cada transferencia.
+ * @param incr false para leer siempre la misma dirección, por ejemplo el color de un relleno.
+ */
+void PIO_LCD_SetBlock(pio_lcd_block_t *blk, const void *data, uint32_t count, enum dma_channel_transfer_size size, bool incr);
+
+/**
+ * @brief Llena el bloque que termina el flujo del DMA.
+ *
+ * @param blk Bloque a llenar.
+ */
+void PIO_LCD_SetBlockEnd(pio_lcd_block_t *blk);
+
+/**
+ * @brief Empieza a enviar una lista de bloques terminada con @see PIO_LCD_SetBlockEnd.
+ *
+ * La lista debe mantenerse valida hasta la interrupción de @c dma_tx en DMA_IRQ_0.
+ *
+ * @param blocks Lista de bloques.
+ */
+void PIO_LCD_StartBlocks(const pio_lcd_block_t *blocks);
+
+/**
+ * @}
+ */
+
+#endif
@@ -49,6 +49,22 @@
 /*! @brief Frecuencia de la comunicacion spi con el RTC*/
 #define SPI0_FREQ (1000 * 1000)
 
+#ifndef LCD_SPI_16BIT
+/*! @brief 1: los pixeles se envian en tramas SPI de 16 bits (RGB565 en orden nativo), 0: en tramas de 8 bits*/
+#define LCD_SPI_16BIT 1
+#endif
+
+#ifndef LCD_PIO
+/*! @brief 1: el LCD usa el transporte por PIO de pio_lcd_driver.c, 0: usa el SPI1*/
+#define LCD_PIO 0
+#endif
+
+/*! @brief Bits de cada transferencia de pixeles, el PIO siempre envia el RGB565 en orden nativo*/
+#define LCD_PIXEL_BITS ((LCD_SPI_16BIT || LCD_PIO) ? 16 : 8)
+
+/*! @brief Transferencias de DMA necesarias por cada pixel RGB565*/
+#define LCD_DMA_XFERS_PER_PIXEL (LCD_PIXEL_BITS == 16 ? 1 : 2)
+
 
 /*! @brief LCD command/data selection pin*/
 #define LCD_DC_PIN 8
@@ -125,6 +141,27 @@ void SPI_WriteByte(uint8_t Value);
  */
 void SPI_Write_nByte(uint8_t pData[], uint32_t Len);
 
+/**
+ * @brief Función que cambia el tamaño de trama del puerto SPI del LCD.
+ *
+ * Espera a que el puerto termine de transmitir antes de cambiar el formato, los comandos
+ * siempre se envian en tramas de 8 bits y los pixeles en tramas de 16 bits si @ref LCD_SPI_16BIT.
+ *
+ * @param bits Número de bits por trama (8 o 16).
+ *
+ * @return void
+ */
+void SPI_SetDataBits(uint8_t bits);
+
+/**
+ * @brief Función que espera a que el puerto SPI del LCD termine de transmitir.
+ *
+ * Necesaria antes de cambiar el pin DC, ya que la FIFO del SPI puede tener datos pendientes.
+ *
+ * @return void
+ */
+void SPI_WaitIdle(void);
+
 /**
  * @}
  */
@@ -154,6 +191,13 @@ void config_pwm(void);
  */
 void config_gpio(void);
 
+/**
+ * @brief Función que configura los pines de control del display (DC, CS, RESET y BL).
+ *
+ * Compartida con el transporte por PIO, que luego toma el pin DC.
+ */
+void config_display_pins(void);
+
 void set_pwm(uint8_t level);
 
 /**
@@ -0,0 +1,203 @@
+/**
+ * @file filters.h
+ *
+ * @brief Filtros digitales en punto fijo para señales muestreadas como la del MAX30102.
+ *
+ * Cada filtro guarda su estado en una estructura y procesa una muestra a la vez o un bloque de
+ * muestras, por ejemplo todas las leídas de la FIFO del sensor. Los bloques pueden procesarse en
+ * el mismo arreglo (in == out). Ninguno usa flotantes ni multiplicaciones de 64 bits, que el
+ * Cortex-M0+ hace por software.
+ *
+ * - Promedio móvil con suma acumulada: un costo por muestra que no depende de la longitud.
+ * - Remoción de DC con un IIR de un polo.
+ * - FIR simétrico con coeficientes Q15, la mitad de multiplicaciones.
+ * - Biquad en forma directa I con coeficientes Q14.
+ *
+ * @see filters.c
+ * @see pulse_read.c
+ */
+
+#ifndef FILTERS_H
+#define FILTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*! @brief Ubica un filtro en SRAM cuando se compila con FAST_MEM_RAM, como el resto del procesamiento del pulso*/
+#if FAST_MEM_RAM
+#define FILTER_FAST_FUNC(func) __not_in_flash_func(func)
+#else
+#define FILTER_FAST_FUNC(func) func
+#endif
+
+/*! @brief Máximo de taps de un FIR, la historia es un buffer circular potencia de dos*/
+#define FILTER_FIR_MAX_TAPS 32
+/*! @brief Coeficiente en Q15 (FIR) a partir de un valor en [-1, 1)*/
+#define FILTER_Q15(x) ((int16_t)((x) * 32768.0 + ((x) < 0 ? -0.5 : 0.5)))
+/*! @brief Coeficiente en Q14 (biquad) a partir de un valor en [-2, 2)*/
+#define FILTER_Q14(x) ((int16_t)((x) * 16384.0 + ((x) < 0 ? -0.5 : 0.5)))
+
+/**
+ * @brief Promedio móvil de len muestras con una suma acumulada.
+ *
+ * Mientras no haya len muestras devuelve la muestra sin promediar.
+ */
+typedef struct filter_ma
+{
+    int32_t *buf;   /**< Últimas len muestras, lo da quien usa el filtro*/
+    uint16_t len;   /**< Muestras promediadas*/
+    uint16_t pos;   /**< Posición de la muestra más antigua en buf*/
+    uint16_t fill;  /**< Muestras recibidas, hasta len*/
+    int32_t sum;    /**< Suma de las muestras de buf*/
+} filter_ma_t;
+
+/**
+ * @brief Remoción de DC: resta un promedio exponencial con constante de tiempo de 2^shift muestras.
+ */
+typedef struct filter_dc
+{
+    int32_t acc;    /**< Nivel DC en Q8*/
+    uint8_t shift;  /**< Log2 de la constante de tiempo*/
+    bool primed;    /**< El nivel DC empieza en la primera muestra para no esperar a que suba*/
+} filter_dc_t;
+
+/**
+ * @brief FIR simétrico de 2*half+1 taps, coeficientes c[0..half] en Q15 con c[half] el central.
+ *
+ * Las entradas se saturan a 16 bits, con una suma de |coeficientes| hasta 2^16 (ganancia 2) el
+ * acumulador de 32 bits no se desborda.
+ */
+typedef struct filter_fir
+{
+    const int16_t *coefs;                   /**< half+1 coeficientes, del extremo al centro*/
+    uint8_t half;                           /**< Taps a cada lado del central, hasta 15*/
+    uint8_t pos;                            /**< Posición de la muestra más nueva en hist*/
+    int16_t hist[FILTER_FIR_MAX_TAPS];      /**< Últimas muestras*/
+} filter_fir_t;
+
+/**
+ * @brief Biquad en forma directa I: y = b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2, coeficientes en Q14.
+ *
+ * Las entradas se saturan a 16 bits, la suma de |coeficientes| debe ser menor que 4 para que el
+ * acumulador de 32 bits no se desborde (un pasabanda de unos Hz a 50 Hz suma menos de 3).
+ */
+typedef struct filter_biquad
+{
+    int16_t b0, b1, b2; /**< Coeficientes del numerador*/
+    int16_t a1, a2;     /**< Coeficientes del denominador, a0 = 1*/
+    int32_t x1, x2;     /**< Entradas anteriores*/
+    int32_t y1, y2;     /**< Salidas anteriores*/
+    int32_t err;        /**< Residuo del último desplazamiento de Q14*/
+} filter_biquad_t;
+
+/**
+ * @brief Inicializa un promedio móvil.
+ *
+ * @param f filtro.
+ * @param buf memoria para len muestras.
+ * @param len muestras promediadas.
+ */
+void filter_ma_init(filter_ma_t *f, int32_t *buf, uint16_t len);
+
+/**
+ * @brief Filtra una muestra con el promedio móvil.
+ *
+ * @param f filtro.
+ * @param x muestra.
+ * @return promedio de las últimas len muestras.
+ */
+int32_t filter_ma(filter_ma_t *f, int32_t x);
+
+/**
+ * @brief Filtra un bloque de muestras con el promedio móvil.
+ *
+ * @param f filtro.
+ * @param in muestras.
+ * @param out salidas, puede ser in.
+ * @param n número de muestras.
+ */
+void filter_ma_block(filter_ma_t *f, const int32_t *in, int32_t *out, uint16_t n);
+
+/**
+ * @brief Inicializa una remoción de DC.
+ *
+ * @param f filtro.
+ * @param shift log2 de la constante de tiempo en muestras (4: 16 muestras).
+ */
+void filter_dc_init(filter_dc_t *f, uint8_t shift);
+
+/**
+ * @brief Quita el nivel DC de una muestra.
+ *
+ * @param f filtro.
+ * @param x muestra.
+ * @return muestra menos el nivel DC.
+ */
+int32_t filter_dc(filter_dc_t *f, int32_t x);
+
+/**
+ * @brief Quita el nivel DC de un bloque de muestras.
+ *
+ * @param f filtro.
+ * @param in muestras.
+ * @param out salidas, puede ser in.
+ * @param n número de muestras.
+ */
+void filter_dc_block(filter_dc_t *f, const int32_t *in, int32_t *out, uint16_t n);
+
+/**
+ * @brief Inicializa un FIR simétrico.
+ *
+ * @param f filtro.
+ * @param coefs half+1 coeficientes en Q15, deben existir mientras se use el filtro.
+ * @param half taps a cada lado del central, hasta (FILTER_FIR_MAX_TAPS-1)/2.
+ */
+void filter_fir_init(filter_fir_t *f, const int16_t *coefs, uint8_t half);
+
+/**
+ * @brief Filtra una muestra con el FIR.
+ *
+ * @param f filtro.
+ * @param x muestra, se satura a 16 bits.
+ * @return salida del FIR, con un retardo de half muestras.
+ */
+int32_t filter_fir(filter_fir_t *f, int32_t x);
+
+/**
+ * @brief Filtra un bloque de muestras con el FIR.
+ *
+ * @param f filtro.
+ * @param in muestras.
+ * @param out salidas, puede ser in.
+ * @param n número de muestras.
+ */
+void filter_fir_block(filter_fir_t *f, const int32_t *in, int32_t *out, uint16_t n);
+
+/**
+ * @brief Inicializa un biquad.
+ *
+ * @param f filtro.
+ * @param coefs b0, b1, b2, a1 y a2 en Q14.
+ */
+void filter_biquad_init(filter_biquad_t *f, const int16_t coefs[5]);
+
+/**
+ * @brief Filtra una muestra con el biquad.
+ *
+ * @param f filtro.
+ * @param x muestra, se satura a 16 bits.
+ * @return salida del biquad.
+ */
+int32_t filter_biquad(filter_biquad_t *f, int32_t x);
+
+/**
+ * @brief Filtra un bloque de muestras con el biquad.
+ *
+ * @param f filtro.
+ * @param in muestras.
+ * @param out salidas, puede ser in.
+ * @param n número de muestras.
+ */
+void filter_biquad_block(filter_biquad_t *f, const int32_t *in, int32_t *out, uint16_t n);
+
+#endif
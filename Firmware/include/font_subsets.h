@@ -0,0 +1,66 @@
+/**
+ * @file font_subsets.h
+ *
+ * @brief Caracteres que dibuja cada fuente de las pantallas y fuentes que usa cada widget.
+ *
+ * Con @c FONT_SUBSETS (lv_conf.h) el firmware enlaza copias de las fuentes Montserrat que solo
+ * tienen los glifos de estas listas, generadas en src/font_subsets.c por host/font_subsets_gen.c.
+ * Después de cambiar un texto de screens.c con caracteres nuevos se agrega a su lista y se corre:
+ *
+ *     cmake --build build_host --target font_subsets_update
+ *
+ * Un caracter que no esté en la lista no se dibuja y no ocupa ancho.
+ *
+ * @see screens.c
+ * @see font_subsets_gen.c
+ */
+
+#ifndef FONT_SUBSETS_H
+#define FONT_SUBSETS_H
+
+#include "../lv_conf.h"
+#include "../lvgl/lvgl.h"
+
+/**
+ * @addtogroup FONT_SUBSETS_GLYPHS
+ *
+ * @{
+ *
+ * Caracteres de cada fuente recortada, en UTF-8 y en cualquier orden.
+ */
+/*! @brief Pasos, calorías, distancia y pulso: "Steps: 0", "0cals", "0m", "70 bpm", "--" sin pulso */
+#define FONT_SUBSET_GLYPHS_10 " -0123456789:Sabcelmpst"
+/*! @brief Fuente por defecto, batería: símbolo de carga y "100%" */
+#define FONT_SUBSET_GLYPHS_14 "0123456789%" LV_SYMBOL_BATTERY_FULL LV_SYMBOL_BATTERY_3 LV_SYMBOL_BATTERY_2 \
+                              LV_SYMBOL_BATTERY_1 LV_SYMBOL_BATTERY_EMPTY
+/*! @brief Fecha: "10/12/2024 WED", con las letras de todos los días */
+#define FONT_SUBSET_GLYPHS_18 " /0123456789ADEFHIMNORSTUW"
+/*! @brief Hora: "15:45" */
+#define FONT_SUBSET_GLYPHS_48 "0123456789:"
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup FONT_SUBSETS_FONTS
+ *
+ * @{
+ *
+ * Fuentes de los widgets, las recortadas o las completas de LVGL según @c FONT_SUBSETS.
+ */
+#if FONT_SUBSETS
+#define FONT_UI_10 (&montserrat_10_subset)
+#define FONT_UI_14 (&montserrat_14_subset)
+#define FONT_UI_18 (&montserrat_18_subset)
+#define FONT_UI_48 (&montserrat_48_subset)
+#else
+#define FONT_UI_10 (&lv_font_montserrat_10)
+#define FONT_UI_14 (&lv_font_montserrat_14)
+#define FONT_UI_18 (&lv_font_montserrat_18)
+#define FONT_UI_48 (&lv_font_montserrat_48)
+#endif
+/**
+ * @}
+ */
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "pico/stdlib.h"
 #include "../drivers/spi_driver.h"
+#include "../drivers/pio_lcd_driver.h"
 
 /**
  * @addtogroup LDC_DIMENSIONS
@@ -45,6 +46,23 @@
  * @}
  */
 
+/**
+ * @addtogroup LDC_QUEUE
+ *
+ * @{
+ *
+ * Cola de comandos y datos enviada por el LCD de forma asíncrona.
+ */
+/*! @brief Máximo de segmentos (comandos, parametros o pixeles) en la cola*/
+#define LCD_QUEUE_LEN 16
+/*! @brief Coalescer ventanas contiguas con el mismo ancho en un solo RAMWR*/
+#define LCD_QUEUE_COALESCE 1
+/*! @brief Pixeles que debe ahorrar una fila recortada al circulo para enviarla en su propia ventana*/
+#define LCD_ROUND_MIN_SAVE 16
+/**
+ * @}
+ */
+
 /**
  * @addtogroup LDC_COLORS
  *
@@ -112,6 +130,28 @@ typedef struct
 
 extern lcd_t LCD;
 
+/**
+ * @brief Segmento de la cola del LCD, un comando, sus parametros o un bloque de pixeles.
+ */
+typedef struct
+{
+    const void *data;   /**< Datos a enviar por DMA, NULL para enviar @c bytes*/
+    uint32_t len;       /**< Número de tramas a enviar*/
+    uint8_t bytes[4];   /**< Comando o parametros cortos, se escriben directo en la FIFO del SPI*/
+    uint16_t color;     /**< Color de los rellenos, @c data apunta aquí*/
+    bool fill;          /**< Leer @c data sin incrementar, un relleno de un solo color*/
+    uint8_t dc;         /**< Nivel del pin DC, 0 comando, 1 dato*/
+    uint8_t bits;       /**< Tamaño de trama SPI, 8 o 16*/
+#if LCD_PIO
+    uint32_t words[5];  /**< Cabecera del bloque para el PIO y, en los segmentos cortos, un byte por palabra*/
+#endif
+} lcd_segment_t;
+
+/**
+ * @brief Callback llamado desde la interrupción del DMA cuando la cola termina.
+ */
+typedef void (*lcd_done_cb_t)(void);
+
 /**
  * @addtogroup LDC_FUNCTIONS
  *
@@ -150,8 +190,9 @@ void LCD_1IN28_SetWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint1
  * @brief Función que limpia la pantalla del display.
  *
  * Esta función limpia la pantalla del display, pintando toda la pantalla de un color especifico.
+ * Usa @see LCD_FillRect y espera a que termine, no necesita buffer.
  *
- * @param color Color con el que se va a pintar la pantalla.
+ * @param color Color RGB565 con el que se va a pintar la pantalla.
  *
  */
 void LCD_Clear(uint16_t color);
@@ -159,7 +200,8 @@ void LCD_Clear(uint16_t color);
 /**
  * @brief Función que muestra una imagen en el display.
  *
- * Esta función muestra una imagen en el display, la imagen debe ser un arreglo de 16 bits.
+ * Esta función muestra una imagen en el display, la imagen debe ser un arreglo de 16 bits
+ * en el formato de los buffers de LVGL. Usa @see LCD_BlitRect y espera a que termine.
  *
  * @param image Arreglo de 16 bits que contiene la imagen.
  */
@@ -169,7 +211,9 @@ void LCD_Display(uint16_t *image);
 /**
  * @brief Función que muestra una imagen en el display.
  *
- * Esta función muestra una imagen en el display, la imagen debe ser un arreglo de 16 bits.
+ * Esta función muestra una parte de una imagen de pantalla completa en el display, la imagen
+ * debe ser un arreglo de 16 bits. Xend y Yend no se incluyen. Usa @see LCD_BlitRect y espera
+ * a que termine.
  *
  * @param Xstart Coordenada X de inicio.
  * @param Ystart Coordenada Y de inicio.
@@ -179,6 +223,127 @@ void LCD_Display(uint16_t *image);
  */
 void LCD_1IN28_DisplayWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t *Image);
 
+/**
+ * @brief Encola un comando con sus parametros.
+ *
+ * @param cmd Comando a enviar.
+ * @param params Parametros del comando, máximo 4.
+ * @param len Número de parametros.
+ */
+void LCD_QueueCommand(uint8_t cmd, const uint8_t *params, uint8_t len);
+
+/**
+ * @brief Encola la configuración de la ventana de dibujo (CASET, RASET y RAMWR).
+ *
+ * Si la ventana continua justo debajo de la anterior con el mismo ancho, no se
+ * encola ningún comando y los pixeles continuan el RAMWR anterior.
+ *
+ * @param Xstart Coordenada X de inicio.
+ * @param Ystart Coordenada Y de inicio.
+ * @param Xend Coordenada X de fin.
+ * @param Yend Coordenada Y de fin.
+ */
+void LCD_QueueWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend);
+
+/**
+ * @brief Encola un bloque de pixeles RGB565 para enviar por DMA.
+ *
+ * El buffer debe mantenerse valido hasta que se llame el callback de @see LCD_QueueStart.
+ *
+ * @param pixels Pixeles a enviar.
+ * @param count Número de pixeles.
+ */
+void LCD_QueuePixels(const uint16_t *pixels, uint32_t count);
+
+/**
+ * @brief Empieza a enviar la cola y retorna inmediatamente.
+ *
+ * Los comandos cortos se escriben directo en la FIFO del SPI y los pixeles por DMA,
+ * la interrupción del DMA continua con el resto de la cola. Con @ref LCD_PIO toda la
+ * cola sale en un solo flujo de DMA y solo hay una interrupción al final.
+ *
+ * @param done_cb Función llamada desde la interrupción cuando se envia toda la cola.
+ */
+void LCD_QueueStart(lcd_done_cb_t done_cb);
+
+/**
+ * @brief Encola un relleno de un solo color.
+ *
+ * El DMA lee siempre la misma palabra, no necesita buffer. Se envia en tramas de 16 bits
+ * sin importar @ref LCD_SPI_16BIT.
+ *
+ * @param color Color RGB565.
+ * @param count Número de pixeles.
+ */
+void LCD_QueueFill(uint16_t color, uint32_t count);
+
+/**
+ * @brief Rellena un rectangulo de un color de forma asíncrona.
+ *
+ * La cola debe estar libre, @see LCD_QueueBusy.
+ *
+ * @param Xstart Coordenada X de inicio.
+ * @param Ystart Coordenada Y de inicio.
+ * @param Xend Coordenada X de fin, incluida.
+ * @param Yend Coordenada Y de fin, incluida.
+ * @param color Color RGB565.
+ * @param done_cb Función llamada desde la interrupción cuando termina el relleno, puede ser NULL.
+ */
+void LCD_FillRect(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t color, lcd_done_cb_t done_cb);
+
+/**
+ * @brief Envia un rectangulo de una imagen por DMA y retorna inmediatamente.
+ *
+ * Si el ancho del rectangulo es igual a @p stride la imagen sale en un solo bloque, si no
+ * se encola fila por fila a medida que la cola se vacia. La imagen debe mantenerse valida
+ * hasta que se llame @p done_cb y la cola debe estar libre, @see LCD_QueueBusy.
+ *
+ * @param Xstart Coordenada X de inicio.
+ * @param Ystart Coordenada Y de inicio.
+ * @param Xend Coordenada X de fin, incluida.
+ * @param Yend Coordenada Y de fin, incluida.
+ * @param image Primer pixel del rectangulo, en el formato de los buffers de LVGL.
+ * @param stride Pixeles entre el inicio de una fila y la siguiente en @p image.
+ * @param done_cb Función llamada desde la interrupción cuando termina el envio, puede ser NULL.
+ */
+void LCD_BlitRect(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, const uint16_t *image, uint16_t stride, lcd_done_cb_t done_cb);
+
+/**
+ * @brief Indica si la cola del LCD se está enviando.
+ *
+ * @return true si hay una transferencia en curso.
+ */
+bool LCD_QueueBusy(void);
+
+/**
+ * @brief Configura el recorte de los pixeles que quedan fuera de la pantalla redonda.
+ *
+ * Calcula para cada fila las columnas dentro del circulo inscrito en la resolución dada,
+ * un pixel es visible si su centro está a una distancia del centro menor o igual al radio.
+ *
+ * @param enable true para recortar las areas enviadas con @see LCD_DrawArea.
+ * @param hor_res Resolución horizontal.
+ * @param ver_res Resolución vertical.
+ */
+void LCD_SetRoundClip(bool enable, uint16_t hor_res, uint16_t ver_res);
+
+/**
+ * @brief Envia un area de pixeles de forma asíncrona.
+ *
+ * Con el recorte redondo activo las filas fuera del circulo no se envian y las filas que ahorran
+ * al menos @ref LCD_ROUND_MIN_SAVE pixeles se envian solo en su tramo visible.
+ *
+ * @param Xstart Coordenada X de inicio.
+ * @param Ystart Coordenada Y de inicio.
+ * @param Xend Coordenada X de fin.
+ * @param Yend Coordenada Y de fin.
+ * @param pixels Pixeles del area, fila por fila.
+ * @param done_cb Función llamada desde la interrupción cuando se envia toda el area.
+ *
+ * @return Número de pixeles que se van a enviar.
+ */
+uint32_t LCD_DrawArea(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, const uint16_t *pixels, lcd_done_cb_t done_cb);
+
 	
 
 
@@ -35,8 +35,14 @@
 #define MAX_MODE_MULTI 0x03
 /**< MAX part ID WHO AM I*/
 #define MAX_PART_ID 0x15
-/**< Maximum buffer length*/
-#define I2C_BUFFER_LENGTH 256
+/*! @brief Muestras libres en la FIFO del MAX30102 cuando interrumpe: con 15 interrumpe al tener 17 muestras, cada 340 ms*/
+#define MAX_FIFO_AFULL 15
+/*! @brief Tiempo entre muestras de la FIFO en ms: 400 Hz promediados de a 8 (pulse_SPO2_config y pulse_FIFO_config)*/
+#define MAX_SAMPLE_PERIOD_MS 20
+/*! @brief Muestras del buffer circular que llena la interrupción, potencia de dos (1.28 s a 50 Hz)*/
+#define MAX_RECORDS 64
+/*! @brief Máscara de los índices del buffer circular*/
+#define MAX_RECORDS_MASK (MAX_RECORDS - 1)
 
 /**
  * @addtogroup rtc_regs RTC_REGISTERS
@@ -244,23 +250,38 @@ typedef union FIFO_CONFIG{
  * @addtogroup record Buffer circular
  * @{
  *
- * Estructura del buffer circular de 4 posiciones.
+ * Estructura del buffer circular que llena la interrupción del MAX30102 y vacía el bucle principal.
+ * 
+ * head y tail cuentan muestras sin envolver, el índice es el conteo con MAX_RECORDS_MASK. Solo la
+ * interrupción escribe head y solo el bucle principal escribe tail.
  * 
  */
 typedef struct Record
 {
-    uint32_t red[4];
-    uint32_t IR[4];
-    uint8_t head;
-    uint8_t tail;
+    uint32_t red[MAX_RECORDS];          /**< Muestras del LED rojo*/
+    uint32_t IR[MAX_RECORDS];           /**< Muestras del LED infrarrojo*/
+    uint32_t time_ms[MAX_RECORDS];      /**< Tiempo de cada muestra en ms*/
+    volatile uint16_t head;             /**< Muestras guardadas*/
+    volatile uint16_t tail;             /**< Muestras leídas*/
+    uint16_t overruns;                  /**< Muestras descartadas porque el buffer estaba lleno*/
 } sense_struct_t; //This is our circular buffer of readings from the sensor
 
 /**
  * @}
  */
 
+/**
+ * @brief Indica si la interrupción del MAX30102 dejó muestras nuevas en el buffer circular.
+ * 
+ * @return true si hay muestras para pulse_readIR().
+ */
 bool pulse_getIR_flag();
 
+/**
+ * @brief Cambia la bandera de muestras nuevas, se baja antes de leerlas para no perder una interrupción.
+ * 
+ * @param set valor de la bandera.
+ */
 void pulse_setIR_flag(bool set);
 
 /**
@@ -273,11 +294,27 @@ void pulse_setIR_flag(bool set);
 void max_init();
 
 /**
- * @brief Función que regresa la última medida leída de la FIFO.
+ * @brief Función que saca del buffer circular las muestras de IR que dejó la interrupción.
+ *
+ * No espera al sensor: si no hay muestras regresa 0. Las muestras de una lectura están separadas
+ * MAX_SAMPLE_PERIOD_MS: la copia se detiene donde el tiempo salta, por ejemplo después de muestras
+ * descartadas, y la siguiente lectura empieza con su propio tiempo.
+ * 
+ * @param ir arreglo donde se copian las muestras, de la más antigua a la más nueva.
+ * @param max tamaño del arreglo.
+ * @param time_ms tiempo de la primera muestra en ms.
+ * @return número de muestras copiadas.
+ */
+uint16_t pulse_readIR(uint32_t *ir, uint16_t max, uint32_t *time_ms);
+
+/**
+ * @brief Función que regresa las muestras descartadas porque el buffer circular estaba lleno.
  *
+ * Solo la interrupción escribe el conteo, quien lo lee guarda el último valor para ver cuántas
+ * se descartaron desde entonces.
  * 
- * @return medida del IR de 32 bits.
+ * @return muestras descartadas desde max_init(), envuelve en 65536.
  */
-uint32_t pulse_getIR(void);
+uint16_t pulse_getOverruns(void);
 
 #endif
\ No newline at end of file
@@ -21,6 +21,7 @@
 #define LIB_H
 
 #include <stdio.h>
+#include <string.h>
 
 // Librerias del SDK
 #include "hardware/gpio.h"
@@ -30,11 +31,13 @@
 #include "hardware/i2c.h"
 #include "hardware/gpio.h"
 #include "hardware/adc.h"
+#include "hardware/structs/xip_ctrl.h"
 
 
 // Librerias de la pico
 #include "pico/stdlib.h"
 #include "pico/platform.h"
+#include "pico/multicore.h"
 
 // Librerias de la aplicacion
 #include "./hardware/LCD.h"
@@ -42,13 +45,16 @@
 #include "./hardware/ds1302.h"
 #include "./hardware/max30102.h"
 #include "./drivers/spi_driver.h"
+#include "./drivers/dma_gpu.h"
 #include "./drivers/i2c_driver.h"
 #include "./pulse_read.h"
+#include "./screens.h"
 
 
 //Libreria LGVL para el manejo de la interfaz grafica
 #include "../lv_conf.h"
 #include "../lvgl/lvgl.h"
+#include "../lvgl/src/gpu/lv_gpu_rp2040_interp.h"
 
 
 /*! @brief Frecuencia del PLL del sistema */
@@ -63,6 +69,28 @@
 #define DISP_HOR_RES 240 
 /*! @brief Resolución vertical del display */
 #define DISP_VER_RES 240 
+/*! @brief Reporta por USB cada segundo los pixeles redibujados y ahorrados */
+#define RENDER_STATS 1
+/*! @brief Pantalla redonda: no renderizar ni enviar los pixeles fuera del circulo inscrito en DISP_HOR_RES x DISP_VER_RES */
+#define DISP_ROUND 1
+/*! @brief Tamaño en palabras de la pila del core 1, que renderiza la mitad inferior de cada area de LVGL */
+#define RENDER_CORE1_STACK_WORDS 2048
+/*! @brief Alto en lineas de cada uno de los dos strips de render. LVGL dibuja un strip mientras el DMA envía el otro */
+#define DISP_STRIP_LINES 40
+/*! @brief Rellenos opacos y copias de imagenes de LVGL con canales de DMA libres (gpu_fill_cb y gpu_wait_cb) */
+#define DISP_DMA_GPU 1
+/*! @brief Mide al arrancar el tiempo por cuadro con distintos altos de strip, hasta media pantalla */
+#define STRIP_BENCH 0
+/*! @brief Cuadros completos que se redibujan por cada alto de strip en @ref STRIP_BENCH */
+#define STRIP_BENCH_FRAMES 20
+/*! @brief Mide al arrancar las mezclas de LVGL por software y con los interpoladores (requiere LV_BLEND_INTERP) */
+#define BLEND_BENCH 0
+/*! @brief Veces que se repite cada caso de @ref BLEND_BENCH sobre un strip de @ref DISP_STRIP_LINES lineas */
+#define BLEND_BENCH_RUNS 10
+/*! @brief Reporta cada segundo los accesos y fallos del cache XIP por refresco, para decidir qué ubicar en SRAM con FAST_MEM_RAM */
+#define XIP_PROFILE 0
+/*! @brief Periodo en ms entre llamadas a lv_timer_handler() cuando nada se anima ni hay areas invalidadas */
+#define SCHED_IDLE_PERIOD_MS 1000
 
 
 typedef struct 
@@ -75,15 +103,55 @@ typedef struct
 /**
  * @brief Estructura para el manejo de las interrupciones.
  * 
+ * Las interrupciones suben las banderas y el bucle principal las baja. Cada una es un byte
+ * volatile y no un campo de bits: escribir un campo lee y reescribe el byte entero, y una
+ * interrupción en medio perdería su bandera.
  */
 typedef struct{
-    uint8_t five_mil :1;
-    uint8_t half     :1;
-    uint8_t full     :1;
-    uint8_t one_half :1;
-    uint8_t          :4;
+    volatile bool render;   /**< La alarma del planificador pide correr LVGL*/
+    volatile bool half;     /**< Pasaron 500 ms*/
+    volatile bool full;     /**< Pasó 1 s*/
 }timer_flags_t;
 
+/**
+ * @brief Modos del planificador de render.
+ * 
+ */
+typedef enum{
+    SCHED_FULL = 0,     /**< Hay animaciones o areas invalidadas: render al ritmo que pide LVGL*/
+    SCHED_IDLE,         /**< Pantalla estática: render cada @ref SCHED_IDLE_PERIOD_MS o al actualizar un widget*/
+    SCHED_MODES
+}sched_mode_t;
+
+/**
+ * @brief Tiempos acumulados por el planificador de render en cada modo.
+ * 
+ */
+typedef struct{
+    uint32_t time_us[SCHED_MODES];  /**< Tiempo en us que el planificador estuvo en cada modo*/
+    uint32_t busy_us[SCHED_MODES];  /**< Tiempo en us que la CPU estuvo despierta en cada modo*/
+    uint32_t runs[SCHED_MODES];     /**< Llamadas a lv_timer_handler() en cada modo*/
+}sched_stats_t;
+
+/**
+ * @brief Estadisticas de refresco acumuladas desde el @c monitor_cb de LVGL.
+ * 
+ */
+typedef struct{
+    uint32_t refreshes;     /**< Número de refrescos*/
+    uint32_t px_flushed;    /**< Pixeles de las areas invalidadas que se redibujaron*/
+    uint32_t px_saved;      /**< Pixeles que no se enviaron respecto a redibujar toda la pantalla*/
+    uint32_t time_ms;       /**< Tiempo total de render y envío en ms*/
+    uint32_t dma_xfers;     /**< Transferencias de DMA hechas para enviar los pixeles*/
+    uint32_t flush_bytes;   /**< Bytes de pixeles enviados por SPI, sin los recortados por la pantalla redonda*/
+    uint32_t flush_us;      /**< Tiempo en us desde que arranca el DMA hasta su interrupción*/
+    uint32_t core1_bands;   /**< Bandas renderizadas por el core 1*/
+    uint32_t core1_us;      /**< Tiempo en us que el core 1 pasó renderizando*/
+    uint32_t core1_wait_us; /**< Tiempo en us que el core 0 esperó a que el core 1 terminara su banda*/
+    uint32_t xip_acc;       /**< Accesos al cache XIP durante los refrescos, de los dos cores*/
+    uint32_t xip_hit;       /**< Accesos al cache XIP durante los refrescos que no fueron a la flash*/
+}render_stats_t;
+
 /**
  * @brief Función que actualiza la pantalla principal
  * 
@@ -115,16 +183,6 @@ void smartwatch_init(void);
 */
 void check_for_new_day(datetime_t*now);
 
-/**
- * @brief Guarda los pasos en la memoria del RTC y actualiza el valor para ser mostrado en pantalla.
- * 
- * 
- * @param offset Valor guardado de pasos en el RTC cuando se enciende el smartwatch.
- * @param steps puntero al valor de los pasos de la IMU.
- * 
-*/
-void save_steps(uint32_t offset, uint32_t*steps);
-
 /**
  * @brief Función main del programa.
  * 
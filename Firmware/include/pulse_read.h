@@ -23,12 +23,47 @@
     #define PULSE_READ_H
 
 #include <stdio.h>
+#ifdef SMARTWATCH_HOST
+// Procesamiento de la señal compilado en el PC para medirlo
+#include "../host/host_hw.h"
+#else
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include "./hardware/max30102.h"
+#endif
+#include "filters.h"
+
+/*! @brief Log2 de las muestras que guarda el detector, el buffer circular es potencia de dos para envolver con una máscara*/
+#ifndef PULSE_RING_BITS
+#define PULSE_RING_BITS 8
+#endif
+/*! @brief Muestras que guarda el detector, la ventana máxima (256 son 5.1 s a 50 Hz, 8 s necesitan PULSE_RING_BITS 9)*/
+#define MAX_WINDOW (1u << PULSE_RING_BITS)
+/*! @brief Máscara de los índices del buffer circular*/
+#define PULSE_RING_MASK (MAX_WINDOW - 1)
+/*! @brief Nivel DC mínimo del IR con el dedo sobre el sensor, por debajo no se buscan latidos*/
+#define PULSE_MIN_LEVEL 10000
+/*! @brief Log2 de la constante de tiempo en muestras de la remoción de DC*/
+#define PULSE_DC_SHIFT 4
+/*! @brief Tiempo mínimo entre latidos en ms (220 bpm), un máximo antes es ruido*/
+#define PULSE_MIN_INTERVAL_MS 270
+/*! @brief Tiempo máximo entre latidos en ms (30 bpm), después el pulso se da por perdido*/
+#define PULSE_MAX_INTERVAL_MS 2000
+/*! @brief Resultado de calculate_heart_rate() sin latidos en PULSE_MAX_INTERVAL_MS*/
+#define PULSE_LOST 0xFF
+/*! @brief Intervalos entre latidos que se promedian para el pulso*/
+#define PULSE_BEAT_AVG 4
+/*! @brief Taps a cada lado del central del FIR pasabajos de la señal sin DC*/
+#define PULSE_FIR_HALF 11
+/*! @brief Muestras que add_samples_at() filtra juntas, las de una FIFO llena del MAX30102*/
+#define PULSE_BLOCK 32
 
-/**< Maximum data window*/
-#define MAX_WINDOW 255
+/*! @brief Ubica una función del procesamiento de la señal en SRAM cuando se compila con FAST_MEM_RAM*/
+#if FAST_MEM_RAM
+#define PULSE_FAST_FUNC(func) __not_in_flash_func(func)
+#else
+#define PULSE_FAST_FUNC(func) func
+#endif
 /**
  * 
  * @addtogroup beat_struct Beat Detector Structure
@@ -36,38 +71,117 @@
  *
  * Estructura del detector de pulso
  */
+/**
+ * @brief Cola doble monótona con el mínimo o el máximo de la ventana al frente.
+ *
+ * Guarda los números de muestra de los candidatos: cada muestra nueva saca del final las que ya
+ * no pueden ser el extremo, y las que salen de la ventana se sacan del frente. Cada muestra entra
+ * y sale una vez, el costo por muestra es constante en promedio.
+ */
+typedef struct pulse_deque
+{
+    uint16_t seq[MAX_WINDOW];   /**< Números de muestra, su valor está en filtered_samples*/
+    uint16_t head;              /**< Posición del frente*/
+    uint16_t len;               /**< Candidatos en la cola*/
+} pulse_deque_t;
+
+/**
+ * @brief Latido detectado.
+ */
+typedef struct pulse_beat
+{
+    uint32_t timestamp;     /**< Tiempo del máximo del latido en ms*/
+    uint16_t interval_ms;   /**< Tiempo desde el latido anterior*/
+    uint8_t bpm;            /**< Pulso promedio de los últimos PULSE_BEAT_AVG intervalos*/
+} pulse_beat_t;
+
 typedef struct beat_detector
 {
     uint16_t sample_rate; //100
-    uint8_t window_size; //10
-    uint8_t smoothing_window; //5
-    uint32_t sample[MAX_WINDOW];
-    uint32_t timestamps[MAX_WINDOW];
-    uint32_t filtered_samples[MAX_WINDOW+1];
-    uint8_t round;
-    uint8_t peak_len;
+    uint16_t window_size; /**< Muestras de las que se toman el mínimo y el máximo del umbral, hasta MAX_WINDOW*/
+    bool filters_ready;                     /**< dc y bandpass están inicializados*/
+    filter_dc_t dc;                         /**< Remoción del nivel DC del IR*/
+    filter_biquad_t bandpass;               /**< Pasabanda de la señal sin DC*/
+    int32_t filtered_samples[MAX_WINDOW];   /**< Buffer circular de las muestras filtradas*/
+    uint16_t seq;                           /**< Número de la próxima muestra, va en seq & PULSE_RING_MASK*/
+    pulse_deque_t min_q;                    /**< Mínimo de la ventana*/
+    pulse_deque_t max_q;                    /**< Máximo de la ventana*/
+    bool above;             /**< La señal cruzó el umbral hacia arriba y se sigue su máximo*/
+    int32_t peak_val;       /**< Máximo desde que cruzó el umbral*/
+    uint32_t peak_time;     /**< Tiempo de ese máximo en ms*/
+    uint32_t last_time;     /**< Tiempo de la última muestra en ms*/
+    uint16_t intervals[PULSE_BEAT_AVG]; /**< Últimos intervalos entre latidos en ms*/
+    uint8_t interval_pos;   /**< Posición del próximo intervalo*/
+    uint8_t interval_count; /**< Intervalos guardados, hasta PULSE_BEAT_AVG*/
+    bool has_beat;          /**< Hay un latido anterior en beat*/
+    bool new_beat;          /**< beat no se ha leído con pulse_get_beat()*/
+    pulse_beat_t beat;      /**< Último latido*/
+    uint32_t beats;         /**< Latidos detectados*/
 } beat_detector_t;
 /**
  * @}
  */
 
+/*! @brief Estado del detector de pulso, la configuración se puede cambiar antes de la primera muestra*/
+extern beat_detector_t detect;
+/*! @brief Coeficientes Q15 del FIR pasabajos para filter_fir_init(), del extremo al centro*/
+extern const int16_t pulse_fir_coefs[PULSE_FIR_HALF + 1];
+/*! @brief Coeficientes Q14 del pasabanda del detector para filter_biquad_init(), 1.5 Hz con Q de 0.7 a 50 Hz*/
+extern const int16_t pulse_bandpass_coefs[5];
+
 /**
  * @brief Función para guardar un sample de IR.
  * 
- * Esta función guarda una sample de IR y la suaviza.
+ * Esta función guarda una sample de IR, le quita el nivel DC, la filtra con un pasabanda y busca latidos.
  * @param sample sample de IR  a guardar.
  * 
  * @return None.
  */
 void add_sample(uint32_t sample);
 
+/**
+ * @brief Función para guardar un sample de IR tomado en un tiempo dado.
+ * 
+ * Igual que add_sample() pero con el tiempo de la muestra, para las muestras que se leen
+ * después de tomadas y para alimentar el detector con una señal simulada.
+ * @param sample sample de IR  a guardar.
+ * @param timestamp tiempo de la muestra en ms.
+ * 
+ * @return None.
+ */
+void add_sample_at(uint32_t sample, uint32_t timestamp);
+
+/**
+ * @brief Función para guardar un bloque de samples de IR tomados a intervalos regulares.
+ * 
+ * Filtra el bloque de una vez, por ejemplo todas las muestras leídas de la FIFO del MAX30102.
+ * @param samples samples de IR en orden, del más antiguo al más nuevo.
+ * @param n número de samples.
+ * @param timestamp tiempo del primer sample en ms.
+ * @param period_ms tiempo entre samples en ms.
+ * 
+ * @return None.
+ */
+void add_samples_at(const uint32_t *samples, uint16_t n, uint32_t timestamp, uint16_t period_ms);
+
+/**
+ * @brief Función para leer el último latido.
+ * 
+ * Los latidos se detectan mientras llegan las muestras: la señal filtrada cruza hacia arriba
+ * la mitad entre el mínimo y el máximo de la ventana, y cuando vuelve a bajar su máximo es el
+ * latido. Cada cruce tiene una histéresis de 1/8 de esa diferencia.
+ * @param beat donde se copia el latido.
+ * 
+ * @return true si hubo un latido desde la llamada anterior.
+ */
+bool pulse_get_beat(pulse_beat_t *beat);
+
 /**
  * @brief Función medir el pulso por minuto.
  * 
- * Esta función toma el banco, encuentra los picos y su distancia para encontrar
- * el pulso por minuto.
+ * Devuelve el promedio de los últimos intervalos entre latidos, que se calcula en cada latido.
  * 
- * @return beats per minute.
+ * @return beats per minute, PULSE_LOST si no hay latidos en PULSE_MAX_INTERVAL_MS.
  */
 uint8_t calculate_heart_rate();
 
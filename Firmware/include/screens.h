@@ -0,0 +1,133 @@
+/**
+ * @file screens.h
+ *
+ * @brief Archivo que contiene las cabeceras de las pantallas del smartwatch.
+ *
+ * Construcción de la pantalla principal con LVGL y funciones que actualizan sus widgets con
+ * los datos de los sensores. Se compila en el firmware y en el backend del PC (@see host_display.c),
+ * donde @c SMARTWATCH_HOST reemplaza los drivers de los sensores por los simulados de host_hw.h.
+ *
+ * @authors Maria Del Mar Arbelaez Sandoval
+ *          Manuel Santiago Velasquez
+ *          Julián Mauricio Sánchez Ceballos
+ *
+ * @see screens.c
+ * @see lib.h
+ *
+ * @date 25/11/2024
+ */
+
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef SMARTWATCH_HOST
+// Sensores y RTC simulados en el PC
+#include "../host/host_hw.h"
+#else
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "./hardware/imu.h"
+#include "./hardware/ds1302.h"
+#endif
+
+//Libreria LGVL para el manejo de la interfaz grafica
+#include "../lv_conf.h"
+#include "../lvgl/lvgl.h"
+#include "./font_subsets.h"
+
+/*! @brief Modo de render: 1 invalida solo los widgets cuyo valor cambió, 0 invalida toda la pantalla en cada tick */
+#define RENDER_DIRTY_ONLY 1
+
+/*! @brief Indicador del pulso: 1 dibuja el círculo dentro de un objeto de tamaño fijo e invalida solo lo que cambia,
+ * 0 anima el tamaño, el radio y la posición del objeto con estilos */
+#define PULSE_SPRITE 1
+/*! @brief Radio mínimo del círculo del pulso */
+#define PULSE_RADIUS_MIN 13
+/*! @brief Radio máximo del círculo del pulso, el objeto del indicador mide el doble */
+#define PULSE_RADIUS_MAX 17
+
+/**
+ * @brief Tiempo de CPU de la animación del indicador del pulso.
+ */
+typedef struct
+{
+    uint32_t steps;     /**< Pasos de la animación*/
+    uint32_t anim_us;   /**< Tiempo en us dentro del callback de la animación*/
+    uint32_t draws;     /**< Veces que se dibujó el indicador, una por área y banda de cada core*/
+    uint32_t draw_us;   /**< Tiempo en us dibujando el indicador, sumado entre los cores*/
+} pulse_stats_t;
+
+/*! @brief Pantalla principal */
+extern lv_obj_t *screen1;
+
+/**
+ * @brief Crea la pantalla principal: hora, fecha, batería, pasos, calorías, distancia y pulso.
+ *
+ */
+void create_screen1(void);
+
+/**
+ * @brief Guarda los pasos en la memoria del RTC y actualiza el valor para ser mostrado en pantalla.
+ *
+ *
+ * @param offset Valor guardado de pasos en el RTC cuando se enciende el smartwatch.
+ * @param steps puntero al valor de los pasos de la IMU.
+ *
+*/
+void save_steps(uint32_t offset, uint32_t*steps);
+
+/**
+ * @brief Lee los pasos de la IMU, los guarda y actualiza la barra y el label de pasos.
+ *
+ * @param steps puntero donde se guardan los pasos del día.
+ * @param offset pasos guardados en el RTC al encender.
+ */
+void update_steps(uint32_t*steps,uint32_t offset);
+
+/**
+ * @brief Lee la hora del RTC y actualiza los labels de hora y fecha.
+ *
+ * @param now puntero donde se guarda la hora leída.
+ */
+void update_time(datetime_t*now);
+
+/**
+ * @brief Actualiza el arco y el label de distancia a partir de los pasos.
+ *
+ * @param steps pasos del día.
+ */
+void update_distance(uint32_t steps);
+
+/**
+ * @brief Lee el voltaje de la batería por el ADC y actualiza su label.
+ *
+ */
+void update_battery();
+
+/**
+ * @brief Actualiza el label del pulso.
+ *
+ * @param bpm pulso en latidos por minuto, 0xFF (PULSE_LOST) muestra "--".
+ */
+void update_hr(uint8_t bpm);
+
+/**
+ * @brief Actualiza el arco y el label de calorías.
+ *
+ * @param steps pasos del día.
+ * @param bpm pulso en latidos por minuto.
+ */
+void update_calories(uint32_t steps,uint8_t bpm);
+
+/**
+ * @brief Lee el tiempo de CPU de la animación del pulso.
+ *
+ * @param stats Estructura donde se copian.
+ * @param reset true para ponerlas en cero después de leerlas.
+ */
+void get_pulse_stats(pulse_stats_t *stats, bool reset);
+
+#endif
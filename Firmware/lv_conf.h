@@ -12,8 +12,15 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 1
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *Not needed when the LCD is fed with 16-bit SPI frames or by the PIO transport (LCD_SPI_16BIT, LCD_PIO, set from CMakeLists.txt)*/
+#ifndef LCD_SPI_16BIT
+#define LCD_SPI_16BIT 1
+#endif
+#ifndef LCD_PIO
+#define LCD_PIO 0
+#endif
+#define LV_COLOR_16_SWAP (!LCD_SPI_16BIT && !LCD_PIO)
 
 /*Enable more complex drawing routines to manage screens transparency.
  *Can be used if the UI is above another layer, e.g. an OSD menu or video player.
@@ -56,6 +63,14 @@
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
 
+/*Cut the intermediate buffers from a static arena of this many bytes (per rendering core) instead of the heap.
+ *The arena is emptied at once after each refresh so drawing doesn't fragment the memory of the objects.
+ *If the arena is full the buffer is allocated in the heap. 0 to disable
+ *The watch face needs about 0.3 kB per refresh (see the "draw arena" line of RENDER_STATS)*/
+#ifndef LV_MEM_BUF_ARENA_SIZE
+#define LV_MEM_BUF_ARENA_SIZE (1U * 1024U)
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
 
@@ -71,12 +86,28 @@
 
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
-#define LV_TICK_CUSTOM 0
+#ifndef LV_TICK_CUSTOM
+#define LV_TICK_CUSTOM 1
+#endif
 #if LV_TICK_CUSTOM
-#define LV_TICK_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
-#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
+#define LV_TICK_CUSTOM_INCLUDE "hardware/timer.h"          /*Header for the system time function*/
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (time_us_64() / 1000)  /*Expression evaluating to current system time in ms*/
 #endif   /*LV_TICK_CUSTOM*/
 
+/*Number of cores rendering a refreshed area in parallel (1 or 2).
+ *The area is split in horizontal bands and the driver's `render_start_cb` / `render_wait_cb`
+ *run the extra bands on the other core. The drawing state is kept per core, the heap is locked.*/
+#ifndef LV_DRAW_CORES
+#define LV_DRAW_CORES 2
+#endif
+#if LV_DRAW_CORES > 1
+#define LV_DRAW_CORES_INCLUDE "hardware/sync.h"    /*Header for the core id and lock functions*/
+#define LV_DRAW_CORE_ID_EXPR (get_core_num())      /*Expression evaluating to the id (0..LV_DRAW_CORES-1) of the running core*/
+#define LV_DRAW_LOCK_EXPR (spin_lock_unsafe_blocking(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#define LV_DRAW_UNLOCK_EXPR (spin_unlock_unsafe(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#define LV_DRAW_CORES_MIN_HEIGHT 8                 /*Don't split areas lower than this*/
+#endif   /*LV_DRAW_CORES*/
+
 /*Default Dot Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #define LV_DPI_DEF 130     /*[px/inch]*/
@@ -105,8 +136,39 @@
  * 0: to disable caching */
 #define LV_CIRCLE_CACHE_SIZE 4
 
+/*Use circle data precomputed at build time for the radiuses in LV_CIRCLE_TABLE_RADII (sorted, ascending).
+ *The tables live in flash (Firmware/src/circle_tables.c) and are regenerated with the host build's
+ *`circle_tables_update` target after changing the list. Other radiuses still use the cache above.
+ *The list holds the radiuses the watch faces draw: the buttons, the cards and the round screen elements*/
+#ifndef LV_USE_CIRCLE_TABLES
+#define LV_USE_CIRCLE_TABLES 1
+#endif
+#define LV_CIRCLE_TABLE_RADII 2, 10, 11, 12, 13, 14, 15, 16, 17, 22
+
+/*Keep the coverage of the rings drawn by `lv_draw_arc()` (one quarter per radius and width).
+ *A changed arc value then only sweeps the angle mask over the cached ring instead of evaluating two radius masks.
+ *Every rendering core has its own cache.
+ *LV_ARC_RING_CACHE_SIZE: max. number of rings per core, 0 to disable
+ *LV_ARC_RING_CACHE_MEM: bytes reserved per core, a 240 px ring of 12 px needs about 3 kB, the 45 px arcs 0.5 kB*/
+#ifndef LV_ARC_RING_CACHE_SIZE
+#define LV_ARC_RING_CACHE_SIZE 4
+#endif
+#define LV_ARC_RING_CACHE_MEM (4U * 1024U)
+
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Keep pre-blended sprites of large glyphs (e.g. the digits of a clock).
+ *A letter drawn on a plain background is copied row by row from its sprite instead of being blended again.
+ *The sprites are keyed by font, letter, color and background color so a style change just creates new ones.
+ *LV_GLYPH_SPRITE_CACHE_SIZE: max. number of sprites, 0 to disable
+ *LV_GLYPH_SPRITE_CACHE_MEM: bytes reserved for the sprites' pixels
+ *LV_GLYPH_SPRITE_MIN_HEIGHT: only fonts with at least this line height are cached*/
+#ifndef LV_GLYPH_SPRITE_CACHE_SIZE
+#define LV_GLYPH_SPRITE_CACHE_SIZE 12
+#endif
+#define LV_GLYPH_SPRITE_CACHE_MEM (20U * 1024U)
+#define LV_GLYPH_SPRITE_MIN_HEIGHT 40
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -129,6 +191,12 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #define LV_GPU_DMA2D_CMSIS_INCLUDE
 #endif
 
+/*Blend with the interpolators of the RP2040 (lv_gpu_rp2040_interp.c).
+ *Every rendering core has to call lv_gpu_rp2040_interp_init() once.*/
+#ifndef LV_USE_GPU_RP2040_INTERP
+#define LV_USE_GPU_RP2040_INTERP 0
+#endif
+
 /*Use NXP's PXP GPU iMX RTxxx platforms*/
 #define LV_USE_GPU_NXP_PXP 0
 #if LV_USE_GPU_NXP_PXP
@@ -269,8 +337,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*Complier prefix for a big array declaration in RAM*/
 #define LV_ATTRIBUTE_LARGE_RAM_ARRAY
 
-/*Place performance critical functions into a faster memory (e.g RAM)*/
+/*Place performance critical functions into a faster memory (e.g RAM)
+ *With FAST_MEM_RAM the pico SDK's linker script copies the `.time_critical.*` sections to SRAM at boot,
+ *so the render loop doesn't run from flash through the XIP cache*/
+#if FAST_MEM_RAM
+#define LV_ATTRIBUTE_FAST_MEM __attribute__((section(".time_critical.lvgl")))
+#else
 #define LV_ATTRIBUTE_FAST_MEM
+#endif
 
 /*Prefix variables that are used in GPU accelerated operations, often these need to be placed in RAM sections that are DMA accessible*/
 #define LV_ATTRIBUTE_DMA
@@ -286,14 +360,21 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  *   FONT USAGE
  *===================*/
 
+/*Link subsetted copies of the fonts the watch faces use instead of the full ones below. They only hold
+ *the glyphs listed in Firmware/include/font_subsets.h and live in Firmware/src/font_subsets.c, which is
+ *regenerated with the host build's `font_subsets_update` target after changing the lists*/
+#ifndef FONT_SUBSETS
+#define FONT_SUBSETS 1
+#endif
+
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
  *https://fonts.google.com/specimen/Montserrat*/
-#define LV_FONT_MONTSERRAT_8  1
-#define LV_FONT_MONTSERRAT_10 1
+#define LV_FONT_MONTSERRAT_8  (!FONT_SUBSETS)
+#define LV_FONT_MONTSERRAT_10 (!FONT_SUBSETS)
 #define LV_FONT_MONTSERRAT_12 0
-#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_14 (!FONT_SUBSETS)
 #define LV_FONT_MONTSERRAT_16 0
-#define LV_FONT_MONTSERRAT_18 1
+#define LV_FONT_MONTSERRAT_18 (!FONT_SUBSETS)
 #define LV_FONT_MONTSERRAT_20 0
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_24 0
@@ -308,7 +389,7 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
-#define LV_FONT_MONTSERRAT_48 1
+#define LV_FONT_MONTSERRAT_48 (!FONT_SUBSETS)
 
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_12_SUBPX      0
@@ -323,16 +404,37 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
  *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
+#if FONT_SUBSETS
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(montserrat_10_subset) LV_FONT_DECLARE(montserrat_14_subset) \
+                               LV_FONT_DECLARE(montserrat_18_subset) LV_FONT_DECLARE(montserrat_48_subset)
+#else
 #define LV_FONT_CUSTOM_DECLARE
+#endif
 
 /*Always set a default font*/
+#if FONT_SUBSETS
+#define LV_FONT_DEFAULT &montserrat_14_subset
+#else
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
+#endif
 
 /*Enable handling large font and/or fonts with a lot of characters.
  *The limit depends on the font size, font face and bpp.
  *Compiler error will be triggered if a font needs it.*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
+/*Cache the results of the binary searches of each font (direct mapped): the glyph ids of the letters
+ *in sparse character maps (e.g. the symbols) and the values of fonts kerned by pairs.
+ *The ASCII range and kerning classes (used by the built-in fonts) are read directly and not cached.
+ *LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE: letters per font, 8 bytes each, 0 to cache only the last letter
+ *LV_FONT_FMT_TXT_KERN_CACHE_SIZE: kerning pairs per font, 5 bytes each, 0 to disable*/
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 16
+#endif
+#ifndef LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+#endif
+
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
@@ -70,6 +70,11 @@
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
 
+/*Cut the intermediate buffers from a static arena of this many bytes (per rendering core) instead of the heap.
+ *The arena is emptied at once after each refresh so drawing doesn't fragment the memory of the objects.
+ *If the arena is full the buffer is allocated in the heap. 0 to disable*/
+#define LV_MEM_BUF_ARENA_SIZE 0
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
 
@@ -91,6 +96,18 @@
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
 #endif   /*LV_TICK_CUSTOM*/
 
+/*Number of cores rendering a refreshed area in parallel (1 or 2).
+ *The area is split in horizontal bands and the driver's `render_start_cb` / `render_wait_cb`
+ *run the extra bands on the other core. The drawing state is kept per core, the heap is locked.*/
+#define LV_DRAW_CORES 1
+#if LV_DRAW_CORES > 1
+#define LV_DRAW_CORES_INCLUDE "hardware/sync.h"    /*Header for the core id and lock functions*/
+#define LV_DRAW_CORE_ID_EXPR (get_core_num())      /*Expression evaluating to the id (0..LV_DRAW_CORES-1) of the running core*/
+#define LV_DRAW_LOCK_EXPR (spin_lock_unsafe_blocking(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#define LV_DRAW_UNLOCK_EXPR (spin_unlock_unsafe(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#define LV_DRAW_CORES_MIN_HEIGHT 8                 /*Don't split areas lower than this*/
+#endif   /*LV_DRAW_CORES*/
+
 /*Default Dot Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #define LV_DPI_DEF 130     /*[px/inch]*/
@@ -119,8 +136,32 @@
  * 0: to disable caching */
 #define LV_CIRCLE_CACHE_SIZE 4
 
+/*Use circle data precomputed at build time for the radiuses in LV_CIRCLE_TABLE_RADII (sorted, ascending).
+ *The tables are kept in flash and don't use the cache above*/
+#define LV_USE_CIRCLE_TABLES 0
+#if LV_USE_CIRCLE_TABLES
+    #define LV_CIRCLE_TABLE_RADII 4, 8, 10
+#endif
+
+/*Keep the coverage of the rings drawn by `lv_draw_arc()` (one quarter per radius and width).
+ *A changed arc value then only sweeps the angle mask over the cached ring instead of evaluating two radius masks.
+ *LV_ARC_RING_CACHE_SIZE: max. number of rings per rendering core, 0 to disable
+ *LV_ARC_RING_CACHE_MEM: bytes reserved per rendering core*/
+#define LV_ARC_RING_CACHE_SIZE 0
+#define LV_ARC_RING_CACHE_MEM (4U * 1024U)
+
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Keep pre-blended sprites of large glyphs (e.g. the digits of a clock).
+ *A letter drawn on a plain background is copied row by row from its sprite instead of being blended again.
+ *The sprites are keyed by font, letter, color and background color so a style change just creates new ones.
+ *LV_GLYPH_SPRITE_CACHE_SIZE: max. number of sprites, 0 to disable
+ *LV_GLYPH_SPRITE_CACHE_MEM: bytes reserved for the sprites' pixels
+ *LV_GLYPH_SPRITE_MIN_HEIGHT: only fonts with at least this line height are cached*/
+#define LV_GLYPH_SPRITE_CACHE_SIZE 0
+#define LV_GLYPH_SPRITE_CACHE_MEM (20U * 1024U)
+#define LV_GLYPH_SPRITE_MIN_HEIGHT 40
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -143,6 +184,10 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #define LV_GPU_DMA2D_CMSIS_INCLUDE
 #endif
 
+/*Blend with the interpolators of the RP2040 (lv_gpu_rp2040_interp.c).
+ *Every rendering core has to call lv_gpu_rp2040_interp_init() once.*/
+#define LV_USE_GPU_RP2040_INTERP 0
+
 /*Use NXP's PXP GPU iMX RTxxx platforms*/
 #define LV_USE_GPU_NXP_PXP 0
 #if LV_USE_GPU_NXP_PXP
@@ -347,6 +392,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  *Compiler error will be triggered if a font needs it.*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
+/*Cache the results of the binary searches of each font (direct mapped): the glyph ids of the letters
+ *in sparse character maps (e.g. the symbols) and the values of fonts kerned by pairs.
+ *The ASCII range and kerning classes (used by the built-in fonts) are read directly and not cached.
+ *LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE: letters per font, 8 bytes each, 0 to cache only the last letter
+ *LV_FONT_FMT_TXT_KERN_CACHE_SIZE: kerning pairs per font, 5 bytes each, 0 to disable*/
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
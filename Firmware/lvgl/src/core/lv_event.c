@@ -34,7 +34,7 @@ static bool event_is_bubbled(lv_event_t * e);
 /**********************
  *  STATIC VARIABLES
  **********************/
-static lv_event_t * event_head;
+static lv_event_t * event_head[LV_DRAW_CORES];   /*Draw events are sent from every rendering core*/
 
 /**********************
  *      MACROS
@@ -67,14 +67,15 @@ lv_res_t lv_event_send(lv_obj_t * obj, lv_event_code_t event_code, void * param)
     /*Build a simple linked list from the objects used in the events
      *It's important to know if an this object was deleted by a nested event
      *called from this `event_cb`.*/
-    e.prev = event_head;
-    event_head = &e;
+    uint32_t core = LV_DRAW_CORE_ID();
+    e.prev = event_head[core];
+    event_head[core] = &e;
 
     /*Send the event*/
     lv_res_t res = event_send_core(&e);
 
     /*Remove this element from the list*/
-    event_head = e.prev;
+    event_head[core] = e.prev;
 
     return res;
 }
@@ -139,7 +140,7 @@ uint32_t lv_event_register_id(void)
 
 void _lv_event_mark_deleted(lv_obj_t * obj)
 {
-    lv_event_t * e = event_head;
+    lv_event_t * e = event_head[LV_DRAW_CORE_ID()];
 
     while(e) {
         if(e->current_target == obj || e->target == obj) e->deleted = 1;
@@ -29,6 +29,14 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_CORES > 1
+/*A band of the draw buffer rendered by the other core*/
+typedef struct {
+    lv_area_t mask;
+    lv_obj_t * top_act_scr;
+    lv_obj_t * top_prev_scr;
+} lv_refr_band_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -37,6 +45,11 @@ static void lv_refr_join_area(void);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
 static void lv_refr_area_part(const lv_area_t * area_p);
+static void lv_refr_area_mask(lv_area_t * mask_p, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr);
+#if LV_DRAW_CORES > 1
+static void lv_refr_band(void * param);
+#endif
+static bool lv_refr_circle_clip(lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
@@ -517,10 +530,16 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
+    /*On round displays render and flush only the part of the draw_buf which is visible.
+     *The buffer is not screen sized in normal mode so draw_buf->area can be shrunk here.*/
+    if(disp_refr->driver->circle_clip && !disp_refr->driver->full_refresh && !disp_refr->driver->direct_mode) {
+        if(lv_refr_circle_clip(&draw_buf->area) == false) return;
+    }
+
     /*Get the new mask from the original area and the act. draw_buf
      It will be a part of 'area_p'*/
     lv_area_t start_mask;
-    _lv_area_intersect(&start_mask, area_p, &draw_buf->area);
+    if(_lv_area_intersect(&start_mask, area_p, &draw_buf->area) == false) return;
 
     /*Get the most top object which is not covered by others*/
     top_act_scr = lv_refr_get_top_obj(&start_mask, lv_disp_get_scr_act(disp_refr));
@@ -528,10 +547,60 @@ static void lv_refr_area_part(const lv_area_t * area_p)
         top_prev_scr = lv_refr_get_top_obj(&start_mask, disp_refr->prev_scr);
     }
 
+#if LV_DRAW_CORES > 1
+    /*Let the other core render the lower half of the area meanwhile this core renders the upper half.
+     *The top objects cover the whole area so they cover both halves too.*/
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_refr_band_t band;
+    bool band_started = false;
+    lv_coord_t h = lv_area_get_height(&start_mask);
+    if(drv->render_start_cb && drv->render_wait_cb && h >= LV_DRAW_CORES_MIN_HEIGHT) {
+        band.mask = start_mask;
+        band.mask.y1 = start_mask.y1 + h / 2;
+        band.top_act_scr = top_act_scr;
+        band.top_prev_scr = top_prev_scr;
+        band_started = drv->render_start_cb(drv, lv_refr_band, &band);
+        if(band_started) start_mask.y2 = band.mask.y1 - 1;
+    }
+#endif
+
+    lv_refr_area_mask(&start_mask, top_act_scr, top_prev_scr);
+
+#if LV_DRAW_CORES > 1
+    if(band_started) drv->render_wait_cb(drv);
+#endif
+
+    /*In true double buffered mode flush only once when all areas were rendered.
+     *In normal mode flush after every area*/
+    if(disp_refr->driver->full_refresh == false) {
+        draw_buf_flush();
+    }
+}
+
+#if LV_DRAW_CORES > 1
+/**
+ * Render a band of the draw buffer. Called on the other core by the driver's `render_start_cb`.
+ * @param param pointer to a `lv_refr_band_t`
+ */
+static void lv_refr_band(void * param)
+{
+    lv_refr_band_t * band = param;
+    lv_refr_area_mask(&band->mask, band->top_act_scr, band->top_prev_scr);
+}
+#endif
+
+/**
+ * Draw the screens and layers into a part of the draw buffer
+ * @param mask_p the area to draw, it has to be in the draw buffer
+ * @param top_act_scr the most top object of the active screen which covers the area or NULL
+ * @param top_prev_scr the most top object of the previous screen which covers the area or NULL
+ */
+static void lv_refr_area_mask(lv_area_t * mask_p, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr)
+{
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         if(disp_refr->bg_fn) {
-            disp_refr->bg_fn(&start_mask);
+            disp_refr->bg_fn(mask_p);
         } else if(disp_refr->bg_img) {
             lv_draw_img_dsc_t dsc;
             lv_draw_img_dsc_init(&dsc);
@@ -542,7 +611,7 @@ static void lv_refr_area_part(const lv_area_t * area_p)
             if(res == LV_RES_OK) {
                 lv_area_t a;
                 lv_area_set(&a, 0, 0, header.w - 1, header.h - 1);
-                lv_draw_img(&a, &start_mask, disp_refr->bg_img, &dsc);
+                lv_draw_img(&a, mask_p, disp_refr->bg_img, &dsc);
             }
             else {
                 LV_LOG_WARN("Can't draw the background image");
@@ -553,7 +622,7 @@ static void lv_refr_area_part(const lv_area_t * area_p)
             lv_draw_rect_dsc_init(&dsc);
             dsc.bg_color = disp_refr->bg_color;
             dsc.bg_opa = disp_refr->bg_opa;
-            lv_draw_rect(&start_mask, &start_mask, &dsc);
+            lv_draw_rect(mask_p, mask_p, &dsc);
 
         }
     }
@@ -564,7 +633,7 @@ static void lv_refr_area_part(const lv_area_t * area_p)
             top_prev_scr = disp_refr->prev_scr;
         }
         /*Do the refreshing from the top object*/
-        lv_refr_obj_and_children(top_prev_scr, &start_mask);
+        lv_refr_obj_and_children(top_prev_scr, mask_p);
 
     }
 
@@ -572,17 +641,56 @@ static void lv_refr_area_part(const lv_area_t * area_p)
         top_act_scr = disp_refr->act_scr;
     }
     /*Do the refreshing from the top object*/
-    lv_refr_obj_and_children(top_act_scr, &start_mask);
+    lv_refr_obj_and_children(top_act_scr, mask_p);
 
     /*Also refresh top and sys layer unconditionally*/
-    lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), &start_mask);
-    lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
+    lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), mask_p);
+    lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), mask_p);
+}
 
-    /*In true double buffered mode flush only once when all areas were rendered.
-     *In normal mode flush after every area*/
-    if(disp_refr->driver->full_refresh == false) {
-        draw_buf_flush();
-    }
+/**
+ * Get the smallest distance of a coordinate range from the center of the display,
+ * in half pixel units measured from the pixel centers
+ * @param c1 first coordinate of the range
+ * @param c2 last coordinate of the range
+ * @param res resolution of the display in that direction
+ * @return the distance, 0 if the center is in the range
+ */
+static int32_t lv_refr_circle_dist(int32_t c1, int32_t c2, int32_t res)
+{
+    int32_t d1 = 2 * c1 + 1 - res;
+    int32_t d2 = 2 * c2 + 1 - res;
+    if(d1 <= 0 && d2 >= 0) return 0;
+    return LV_MIN(LV_ABS(d1), LV_ABS(d2));
+}
+
+/**
+ * Shrink an area to the bounding box of its pixels which are inside the circle inscribed in the display.
+ * A pixel is inside if its center is not farther than the radius from the center of the display.
+ * @param area_p pointer to an area to shrink
+ * @return false if no pixel of the area is visible
+ */
+static bool lv_refr_circle_clip(lv_area_t * area_p)
+{
+    int32_t hor = lv_disp_get_hor_res(disp_refr);
+    int32_t ver = lv_disp_get_ver_res(disp_refr);
+    int32_t d = LV_MIN(hor, ver);
+    int32_t dx = lv_refr_circle_dist(area_p->x1, area_p->x2, hor);
+    int32_t dy = lv_refr_circle_dist(area_p->y1, area_p->y2, ver);
+
+    if(dx * dx + dy * dy > d * d) return false;
+
+    /*The widest row of the area is the one closest to the center and vice versa*/
+    lv_sqrt_res_t s;
+    lv_sqrt(d * d - dy * dy, &s, 0x8000);
+    area_p->x1 = LV_MAX(area_p->x1, (hor - s.i) / 2);
+    area_p->x2 = LV_MIN(area_p->x2, (hor - 1 + s.i) / 2);
+
+    lv_sqrt(d * d - dx * dx, &s, 0x8000);
+    area_p->y1 = LV_MAX(area_p->y1, (ver - s.i) / 2);
+    area_p->y2 = LV_MIN(area_p->y2, (ver - 1 + s.i) / 2);
+
+    return true;
 }
 
 /**
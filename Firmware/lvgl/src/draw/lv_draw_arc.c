@@ -9,6 +9,7 @@
 #include "lv_draw_arc.h"
 #include "lv_draw_rect.h"
 #include "lv_draw_mask.h"
+#include "lv_draw_blend.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_mem.h"
@@ -22,6 +23,20 @@
 /**********************
  *      TYPEDEFS
  **********************/
+/*Coverage of the top left quarter of a ring, the other quarters are mirrored*/
+typedef struct {
+    lv_coord_t radius;
+    lv_coord_t width;
+    uint32_t ofs;       /*Index of the ring's rows in `ring_pool`, the coverage follows them*/
+} arc_ring_t;
+
+/*Covered columns of a row of the quarter, counted from the ring's left edge*/
+typedef struct {
+    uint16_t x_start;
+    uint16_t len;
+    uint16_t opa_ofs;   /*Index of the coverage of `x_start` after the rows*/
+} arc_ring_row_t;
+
 typedef struct {
     lv_coord_t center_x;
     lv_coord_t center_y;
@@ -34,6 +49,7 @@ typedef struct {
     lv_draw_rect_dsc_t * draw_dsc;
     const lv_area_t * draw_area;
     const lv_area_t * clip_area;
+    const arc_ring_t * ring;
 } quarter_draw_dsc_t;
 
 /**********************
@@ -45,11 +61,29 @@ typedef struct {
     static void draw_quarter_2(quarter_draw_dsc_t * q);
     static void draw_quarter_3(quarter_draw_dsc_t * q);
     static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area);
+    static void arc_draw_rect(const arc_ring_t * ring, const lv_area_t * coords, const lv_area_t * clip_area,
+                              const lv_draw_rect_dsc_t * dsc);
 #endif /*LV_DRAW_COMPLEX*/
 
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE > 0
+    static const arc_ring_t * arc_ring_get(lv_coord_t radius, lv_coord_t width);
+    static const arc_ring_t * arc_ring_build(uint32_t core, lv_coord_t radius, lv_coord_t width);
+    static void arc_ring_draw(const arc_ring_t * ring, const lv_area_t * coords, const lv_area_t * clip_area,
+                              const lv_draw_rect_dsc_t * dsc);
+    LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t arc_ring_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE > 0
+/*Every rendering core has its own rings, so they are not locked*/
+static arc_ring_t rings[LV_DRAW_CORES][LV_ARC_RING_CACHE_SIZE];
+static uint32_t ring_pool[LV_DRAW_CORES][LV_ARC_RING_CACHE_MEM / sizeof(uint32_t)];
+static uint32_t ring_cnt[LV_DRAW_CORES];
+static uint32_t ring_pool_used[LV_DRAW_CORES];
+static lv_arc_ring_stats_t ring_stats[LV_DRAW_CORES];
+#endif
 
 /**********************
  *      MACROS
@@ -104,23 +138,35 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
     area_in.x2 -= dsc->width;
     area_in.y2 -= dsc->width;
 
-    /*Create inner the mask*/
+    /*A cached ring replaces the inner and outer masks and only its covered pixels are blended*/
+    const arc_ring_t * ring = NULL;
+#if LV_ARC_RING_CACHE_SIZE > 0
+    if(dsc->img_src == NULL) ring = arc_ring_get(radius, dsc->width);
+#endif
+
     int16_t mask_in_id = LV_MASK_ID_INV;
+    int16_t mask_out_id = LV_MASK_ID_INV;
     lv_draw_mask_radius_param_t mask_in_param;
-    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
-        lv_draw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
-        mask_in_id = lv_draw_mask_add(&mask_in_param, NULL);
-    }
-
     lv_draw_mask_radius_param_t mask_out_param;
-    lv_draw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
-    int16_t mask_out_id = lv_draw_mask_add(&mask_out_param, NULL);
+    if(ring == NULL) {
+        /*Create inner the mask*/
+        if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
+            lv_draw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+            mask_in_id = lv_draw_mask_add(&mask_in_param, NULL);
+        }
+
+        lv_draw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
+        mask_out_id = lv_draw_mask_add(&mask_out_param, NULL);
+    }
 
     /*Draw a full ring*/
     if(start_angle + 360 == end_angle || start_angle == end_angle + 360) {
         cir_dsc.radius = LV_RADIUS_CIRCLE;
-        lv_draw_rect(&area_out, clip_area, &cir_dsc);
+        arc_draw_rect(ring, &area_out, clip_area, &cir_dsc);
 
+        /*Release the circles too, else they stay in use in the circle cache*/
+        if(mask_out_id != LV_MASK_ID_INV) lv_draw_mask_free_param(&mask_out_param);
+        if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_free_param(&mask_in_param);
         lv_draw_mask_remove_id(mask_out_id);
         if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_remove_id(mask_in_id);
         return;
@@ -154,6 +200,7 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
         q_dsc.draw_dsc =  &cir_dsc;
         q_dsc.draw_area = &area_out;
         q_dsc.clip_area = clip_area;
+        q_dsc.ring = ring;
 
         draw_quarter_0(&q_dsc);
         draw_quarter_1(&q_dsc);
@@ -161,12 +208,12 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
         draw_quarter_3(&q_dsc);
     }
     else {
-        lv_draw_rect(&area_out, clip_area, &cir_dsc);
+        arc_draw_rect(ring, &area_out, clip_area, &cir_dsc);
     }
 
     lv_draw_mask_free_param(&mask_angle_param);
-    lv_draw_mask_free_param(&mask_out_param);
-    lv_draw_mask_free_param(&mask_in_param);
+    if(mask_out_id != LV_MASK_ID_INV) lv_draw_mask_free_param(&mask_out_param);
+    if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_free_param(&mask_in_param);
 
     lv_draw_mask_remove_id(mask_angle_id);
     lv_draw_mask_remove_id(mask_out_id);
@@ -311,6 +358,27 @@ void lv_draw_arc_get_area(lv_coord_t x, lv_coord_t y, uint16_t radius,  uint16_t
     }
 }
 
+/**
+ * Get the statistics of the ring cache, summed for all rendering cores
+ * @param stats store the hits, misses and skips here
+ * @param reset true: restart counting from zero
+ */
+void lv_draw_arc_ring_stats(lv_arc_ring_stats_t * stats, bool reset)
+{
+    lv_memset_00(stats, sizeof(lv_arc_ring_stats_t));
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE > 0
+    uint32_t core;
+    for(core = 0; core < LV_DRAW_CORES; core++) {
+        stats->hits += ring_stats[core].hits;
+        stats->misses += ring_stats[core].misses;
+        stats->skips += ring_stats[core].skips;
+        if(reset) lv_memset_00(&ring_stats[core], sizeof(lv_arc_ring_stats_t));
+    }
+#else
+    LV_UNUSED(reset);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -329,7 +397,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         quarter_area.x1 = q->center_x + ((lv_trigo_sin(q->end_angle + 90) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
     else if(q->start_quarter == 0 || q->end_quarter == 0) {
         /*Start and/or end arcs here*/
@@ -341,7 +409,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             quarter_area.x2 = q->center_x + ((lv_trigo_sin(q->start_angle + 90) * (q->radius)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
         if(q->end_quarter == 0) {
             quarter_area.x2 = q->center_x + q->radius;
@@ -351,7 +419,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             quarter_area.x1 = q->center_x + ((lv_trigo_sin(q->end_angle + 90) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
     }
     else if((q->start_quarter == q->end_quarter && q->start_quarter != 0 && q->end_angle < q->start_angle) ||
@@ -365,7 +433,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         quarter_area.y2 = q->center_y + q->radius;
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
 }
 
@@ -382,7 +450,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         quarter_area.x1 = q->center_x + ((lv_trigo_sin(q->end_angle + 90) * (q->radius)) >> LV_TRIGO_SHIFT);
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
     else if(q->start_quarter == 1 || q->end_quarter == 1) {
         /*Start and/or end arcs here*/
@@ -394,7 +462,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             quarter_area.x2 = q->center_x + ((lv_trigo_sin(q->start_angle + 90) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
         if(q->end_quarter == 1) {
             quarter_area.x2 = q->center_x - 1;
@@ -404,7 +472,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             quarter_area.x1 = q->center_x + ((lv_trigo_sin(q->end_angle + 90) * (q->radius)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
     }
     else if((q->start_quarter == q->end_quarter && q->start_quarter != 1 && q->end_angle < q->start_angle) ||
@@ -418,7 +486,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         quarter_area.y2 = q->center_y + q->radius;
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
 }
 
@@ -435,7 +503,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         quarter_area.x2 = q->center_x + ((lv_trigo_sin(q->end_angle + 90) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
     else if(q->start_quarter == 2 || q->end_quarter == 2) {
         /*Start and/or end arcs here*/
@@ -447,7 +515,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             quarter_area.y2 = q->center_y + ((lv_trigo_sin(q->start_angle) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
         if(q->end_quarter == 2) {
             quarter_area.x1 = q->center_x - q->radius;
@@ -457,7 +525,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             quarter_area.y1 = q->center_y + ((lv_trigo_sin(q->end_angle) * (q->radius)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
     }
     else if((q->start_quarter == q->end_quarter && q->start_quarter != 2 && q->end_angle < q->start_angle) ||
@@ -471,7 +539,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         quarter_area.y2 = q->center_y - 1;
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
 }
 
@@ -488,7 +556,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         quarter_area.y2 = q->center_y + ((lv_trigo_sin(q->end_angle) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
     else if(q->start_quarter == 3 || q->end_quarter == 3) {
         /*Start and/or end arcs here*/
@@ -500,7 +568,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             quarter_area.y1 = q->center_y + ((lv_trigo_sin(q->start_angle) * (q->radius)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
         if(q->end_quarter == 3) {
             quarter_area.x1 = q->center_x;
@@ -510,7 +578,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             quarter_area.y2 = q->center_y + ((lv_trigo_sin(q->end_angle) * (q->radius - q->width)) >> LV_TRIGO_SHIFT);
 
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-            if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+            if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
         }
     }
     else if((q->start_quarter == q->end_quarter && q->start_quarter != 3 && q->end_angle < q->start_angle) ||
@@ -524,7 +592,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         quarter_area.y2 = q->center_y - 1;
 
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, q->clip_area);
-        if(ok) lv_draw_rect(q->draw_area, &quarter_area, q->draw_dsc);
+        if(ok) arc_draw_rect(q->ring, q->draw_area, &quarter_area, q->draw_dsc);
     }
 }
 
@@ -566,4 +634,245 @@ static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness
     }
 }
 
+/**
+ * Draw a part of the arc
+ * @param ring the cached ring to draw, NULL: draw a rectangle through the inner and outer masks
+ * @param coords outer area of the ring
+ * @param clip_area the part of the ring to draw
+ * @param dsc the arc's rectangle descriptor
+ */
+static void arc_draw_rect(const arc_ring_t * ring, const lv_area_t * coords, const lv_area_t * clip_area,
+                          const lv_draw_rect_dsc_t * dsc)
+{
+#if LV_ARC_RING_CACHE_SIZE > 0
+    if(ring) {
+        arc_ring_draw(ring, coords, clip_area, dsc);
+        return;
+    }
+#else
+    LV_UNUSED(ring);
+#endif
+    lv_draw_rect(coords, clip_area, dsc);
+}
+
 #endif /*LV_DRAW_COMPLEX*/
+
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE > 0
+/**
+ * Get the cached ring with a radius and width, rasterize it if it isn't cached yet
+ * @param radius radius of the ring
+ * @param width width of the ring
+ * @return the ring or NULL if it doesn't fit in the cache
+ */
+static const arc_ring_t * arc_ring_get(lv_coord_t radius, lv_coord_t width)
+{
+    uint32_t core = LV_DRAW_CORE_ID();
+    uint32_t i;
+    for(i = 0; i < ring_cnt[core]; i++) {
+        if(rings[core][i].radius == radius && rings[core][i].width == width) {
+            ring_stats[core].hits++;
+            return &rings[core][i];
+        }
+    }
+
+    const arc_ring_t * ring = arc_ring_build(core, radius, width);
+    if(ring) ring_stats[core].misses++;
+    else ring_stats[core].skips++;
+
+    return ring;
+}
+
+/**
+ * Rasterize the top left quarter of a ring with the same inner and outer masks `lv_draw_arc()` uses
+ * @param core the rendering core whose cache is used
+ * @param radius radius of the ring
+ * @param width width of the ring
+ * @return the new ring or NULL if it doesn't fit in `LV_ARC_RING_CACHE_MEM`
+ */
+static const arc_ring_t * arc_ring_build(uint32_t core, lv_coord_t radius, lv_coord_t width)
+{
+    uint32_t pool_size = sizeof(ring_pool[core]);
+    uint32_t rows_size = radius * sizeof(arc_ring_row_t);
+    if(radius == 0 || rows_size > pool_size) return NULL;
+
+    /*Full: start again, the rings in use are rasterized again in the next refreshes*/
+    if(ring_cnt[core] == LV_ARC_RING_CACHE_SIZE || ring_pool_used[core] + rows_size > pool_size) {
+        ring_cnt[core] = 0;
+        ring_pool_used[core] = 0;
+    }
+
+    /*The masks are evaluated on a ring placed to (0;0)*/
+    lv_area_t area_out;
+    area_out.x1 = 0;
+    area_out.y1 = 0;
+    area_out.x2 = 2 * radius - 1;
+    area_out.y2 = 2 * radius - 1;
+
+    lv_area_t area_in;
+    lv_area_copy(&area_in, &area_out);
+    area_in.x1 += width;
+    area_in.y1 += width;
+    area_in.x2 -= width;
+    area_in.y2 -= width;
+
+    bool has_in = lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0;
+    lv_draw_mask_radius_param_t mask_in_param;
+    lv_draw_mask_radius_param_t mask_out_param;
+    if(has_in) lv_draw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+    lv_draw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
+
+    lv_opa_t * line = lv_mem_buf_get(radius);
+    uint8_t * pool = (uint8_t *)ring_pool[core];
+    arc_ring_t * ring = NULL;
+    uint32_t ofs = ring_pool_used[core];
+    bool restarted = ofs == 0;
+
+    while(ring == NULL) {
+        arc_ring_row_t * rows = (arc_ring_row_t *)(pool + ofs);
+        uint32_t opa_ofs = 0;
+        lv_coord_t y;
+        for(y = 0; y < radius; y++) {
+            /*In the same order as `lv_draw_arc()` adds the masks*/
+            lv_memset_ff(line, radius);
+            lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
+            if(has_in) res = mask_in_param.dsc.cb(line, 0, y, radius, &mask_in_param);
+            if(res != LV_DRAW_MASK_RES_TRANSP) res = mask_out_param.dsc.cb(line, 0, y, radius, &mask_out_param);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(line, radius);
+
+            lv_coord_t x1 = 0;
+            lv_coord_t x2 = radius - 1;
+            while(x1 <= x2 && line[x1] == LV_OPA_TRANSP) x1++;
+            while(x2 >= x1 && line[x2] == LV_OPA_TRANSP) x2--;
+            lv_coord_t len = x2 - x1 + 1;
+
+            if(ofs + rows_size + opa_ofs + len > pool_size) break;
+            rows[y].x_start = x1;
+            rows[y].len = len;
+            rows[y].opa_ofs = opa_ofs;
+            lv_memcpy(pool + ofs + rows_size + opa_ofs, &line[x1], len);
+            opa_ofs += len;
+        }
+
+        if(y == radius) {
+            ring = &rings[core][ring_cnt[core]];
+            ring->radius = radius;
+            ring->width = width;
+            ring->ofs = ofs;
+            ring_cnt[core]++;
+            /*Keep the next ring's rows aligned*/
+            ring_pool_used[core] = (ofs + rows_size + opa_ofs + 3) & ~(uint32_t)3;
+        }
+        else if(restarted) {
+            break;
+        }
+        else {
+            /*Try again in an empty cache*/
+            ring_cnt[core] = 0;
+            ring_pool_used[core] = 0;
+            ofs = 0;
+            restarted = true;
+        }
+    }
+
+    lv_mem_buf_release(line);
+    if(has_in) lv_draw_mask_free_param(&mask_in_param);
+    lv_draw_mask_free_param(&mask_out_param);
+
+    return ring;
+}
+
+/**
+ * Blend the covered pixels of a cached ring, like `lv_draw_rect()` draws the arc's background through the masks
+ * @param ring the cached ring
+ * @param coords outer area of the ring
+ * @param clip_area the part of the ring to draw
+ * @param dsc the arc's rectangle descriptor, only a plain background is drawn
+ */
+static void arc_ring_draw(const arc_ring_t * ring, const lv_area_t * coords, const lv_area_t * clip_area,
+                          const lv_draw_rect_dsc_t * dsc)
+{
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, coords, clip_area)) return;
+
+    lv_coord_t radius = ring->radius;
+    const uint8_t * pool = (const uint8_t *)ring_pool[LV_DRAW_CORE_ID()];
+    const arc_ring_row_t * rows = (const arc_ring_row_t *)(pool + ring->ofs);
+    const lv_opa_t * ring_opa = pool + ring->ofs + radius * sizeof(arc_ring_row_t);
+    lv_opa_t opa = dsc->bg_opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->bg_opa;
+
+    /*The same radius mask `lv_draw_rect()` adds, a full ring masks its outer edge once more.
+     *Without radius it would only clip to `coords` but the spans are already in it.*/
+    lv_draw_mask_radius_param_t mask_rout_param;
+    int16_t mask_rout_id = LV_MASK_ID_INV;
+    if(dsc->radius > 0) {
+        lv_draw_mask_radius_init(&mask_rout_param, coords, LV_MIN(dsc->radius, radius), false);
+        mask_rout_id = lv_draw_mask_add(&mask_rout_param, NULL);
+    }
+
+    lv_opa_t * mask_buf = lv_mem_buf_get(2 * radius);
+    lv_area_t blend_area;
+    lv_coord_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        /*The bottom half mirrors the top*/
+        lv_coord_t ring_y = y - coords->y1;
+        if(ring_y >= radius) ring_y = 2 * radius - 1 - ring_y;
+        const arc_ring_row_t * row = &rows[ring_y];
+        if(row->len == 0) continue;
+        const lv_opa_t * row_opa = ring_opa + row->opa_ofs - row->x_start;
+
+        /*The stored span on the left and its mirror on the right, one span if they meet in the middle*/
+        lv_coord_t spans[2][2];
+        uint32_t span_cnt = 2;
+        spans[0][0] = row->x_start;
+        spans[0][1] = row->x_start + row->len - 1;
+        spans[1][0] = 2 * radius - 1 - spans[0][1];
+        spans[1][1] = 2 * radius - 1 - spans[0][0];
+        if(spans[0][1] == radius - 1) {
+            spans[0][1] = spans[1][1];
+            span_cnt = 1;
+        }
+
+        uint32_t s;
+        for(s = 0; s < span_cnt; s++) {
+            blend_area.x1 = LV_MAX(coords->x1 + spans[s][0], draw_area.x1);
+            blend_area.x2 = LV_MIN(coords->x1 + spans[s][1], draw_area.x2);
+            if(blend_area.x1 > blend_area.x2) continue;
+
+            /*Initialize the mask to opa like `lv_draw_rect()`, then apply the others (e.g. the angle)*/
+            lv_opa_t * mask_p = mask_buf;
+            lv_coord_t x = blend_area.x1 - coords->x1;
+            lv_coord_t x_end = blend_area.x2 - coords->x1;
+            for(; x <= x_end && x < radius; x++) *mask_p++ = arc_ring_mix(opa, row_opa[x]);
+            for(; x <= x_end; x++) *mask_p++ = arc_ring_mix(opa, row_opa[2 * radius - 1 - x]);
+
+            lv_coord_t w = lv_area_get_width(&blend_area);
+            if(lv_draw_mask_apply(mask_buf, blend_area.x1, y, w) == LV_DRAW_MASK_RES_TRANSP) continue;
+
+            blend_area.y1 = y;
+            blend_area.y2 = y;
+            _lv_blend_fill(clip_area, &blend_area, dsc->bg_color, mask_buf, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER,
+                           dsc->blend_mode);
+        }
+    }
+
+    lv_mem_buf_release(mask_buf);
+    if(mask_rout_id != LV_MASK_ID_INV) {
+        lv_draw_mask_remove_id(mask_rout_id);
+        lv_draw_mask_free_param(&mask_rout_param);
+    }
+}
+
+/**
+ * Mix the ring's coverage into a mask the same way the radius masks do
+ * @param mask_act the current mask value
+ * @param mask_new the ring's coverage
+ * @return the mixed mask value
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t arc_ring_mix(lv_opa_t mask_act, lv_opa_t mask_new)
+{
+    if(mask_new >= LV_OPA_MAX) return mask_act;
+    if(mask_new <= LV_OPA_MIN) return 0;
+
+    return LV_UDIV255(mask_act * mask_new);
+}
+#endif /*LV_ARC_RING_CACHE_SIZE*/
@@ -31,6 +31,13 @@ typedef struct {
     uint8_t rounded : 1;
 } lv_draw_arc_dsc_t;
 
+/** Counters of the ring cache (`LV_ARC_RING_CACHE_SIZE`)*/
+typedef struct {
+    uint32_t hits;      /**< Arcs drawn with a cached ring*/
+    uint32_t misses;    /**< Rings rasterized and cached*/
+    uint32_t skips;     /**< Arcs drawn with the radius masks because their ring doesn't fit in the cache*/
+} lv_arc_ring_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -65,6 +72,13 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
 void lv_draw_arc_get_area(lv_coord_t x, lv_coord_t y, uint16_t radius,  uint16_t start_angle, uint16_t end_angle,
                           lv_coord_t w, bool rounded, lv_area_t * area);
 
+/**
+ * Get the statistics of the ring cache, summed for all rendering cores
+ * @param stats store the hits, misses and skips here
+ * @param reset true: restart counting from zero
+ */
+void lv_draw_arc_ring_stats(lv_arc_ring_stats_t * stats, bool reset);
+
 /**********************
  *      MACROS
  **********************/
@@ -18,6 +18,8 @@
     #include "../gpu/lv_gpu_nxp_vglite.h"
 #elif LV_USE_GPU_STM32_DMA2D
     #include "../gpu/lv_gpu_stm32_dma2d.h"
+#elif LV_USE_GPU_RP2040_INTERP
+    #include "../gpu/lv_gpu_rp2040_interp.h"
 #endif
 
 /*********************
@@ -357,6 +359,11 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                 }
                 /*Fall down to SW render in case of error*/
             }
+#elif LV_USE_GPU_RP2040_INTERP
+            if(lv_gpu_rp2040_interp_is_enabled()) {
+                lv_gpu_rp2040_interp_fill(disp_buf_first, disp_w, color, NULL, opa, draw_area_w, draw_area_h);
+                return;
+            }
 #endif
             lv_color_t last_dest_color = lv_color_black();
             lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
@@ -389,6 +396,12 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
     }
     /*Masked*/
     else {
+#if LV_USE_GPU_RP2040_INTERP
+        if(lv_gpu_rp2040_interp_is_enabled()) {
+            lv_gpu_rp2040_interp_fill(disp_buf_first, disp_w, color, mask, opa, draw_area_w, draw_area_h);
+            return;
+        }
+#endif
         int32_t x_end4 = draw_area_w - 4;
 
 #if LV_COLOR_DEPTH == 16
@@ -668,9 +681,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     const lv_color_t * map_buf_first = map_buf + map_w * (draw_area->y1 - (map_area->y1 - disp_area->y1));
     map_buf_first += (draw_area->x1 - (map_area->x1 - disp_area->x1));
 
-#if LV_COLOR_SCREEN_TRANSP
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-#endif
 
     int32_t x;
     int32_t y;
@@ -720,6 +731,11 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
             }
 #endif
 
+            if(disp->driver->gpu_copy_cb && lv_area_get_size(draw_area) > GPU_SIZE_LIMIT) {
+                disp->driver->gpu_copy_cb(disp->driver, disp_buf, disp_w, draw_area, map_buf_first, map_w);
+                return;
+            }
+
             /*Software rendering*/
             for(y = 0; y < draw_area_h; y++) {
                 lv_memcpy(disp_buf_first, map_buf_first, draw_area_w * sizeof(lv_color_t));
@@ -768,6 +784,11 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 lv_gpu_stm32_dma2d_blend(disp_buf_first, disp_w, map_buf_first, opa, map_w, draw_area_w, draw_area_h);
                 return;
             }
+#elif LV_USE_GPU_RP2040_INTERP
+            if(lv_gpu_rp2040_interp_is_enabled()) {
+                lv_gpu_rp2040_interp_blend(disp_buf_first, disp_w, map_buf_first, map_w, NULL, opa, draw_area_w, draw_area_h);
+                return;
+            }
 #endif
 
             /*Software rendering*/
@@ -792,6 +813,12 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     }
     /*Masked*/
     else {
+#if LV_USE_GPU_RP2040_INTERP
+        if(lv_gpu_rp2040_interp_is_enabled()) {
+            lv_gpu_rp2040_interp_blend(disp_buf_first, disp_w, map_buf_first, map_w, mask, opa, draw_area_w, draw_area_h);
+            return;
+        }
+#endif
         /*Only the mask matters*/
         if(opa > LV_OPA_MAX) {
             /*Go to the first pixel of the row*/
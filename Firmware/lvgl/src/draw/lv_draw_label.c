@@ -12,6 +12,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "lv_draw_mask.h"
 
 #if LV_USE_GPU_SDL
     #include "../gpu/lv_gpu_sdl.h"
@@ -32,6 +33,21 @@ enum {
 };
 typedef uint8_t cmd_state_t;
 
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+/*A glyph already blended on a plain background*/
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    lv_color_t color;   /*Color of the letter*/
+    lv_color_t bg;      /*Color of the background it was blended on*/
+    uint16_t w;
+    uint16_t h;
+    int16_t y1;         /*First captured row, relative to the glyph's box*/
+    int16_t y2;         /*Last captured row, y1 > y2 if nothing is captured yet*/
+    uint32_t ofs;       /*Index of the first pixel in `sprite_pool`*/
+} glyph_sprite_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -47,11 +63,27 @@ static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 #endif /*LV_USE_EXTERNAL_RENDERER*/
 
+#if LV_USE_EXTERNAL_RENDERER == 0 && LV_GLYPH_SPRITE_CACHE_SIZE > 0
+static bool glyph_sprite_draw(lv_coord_t pos_x, lv_coord_t pos_y, const lv_font_glyph_dsc_t * g,
+                              const lv_area_t * clip_area, const lv_font_t * font_p, uint32_t letter,
+                              lv_color_t color, glyph_sprite_t ** new_sprite);
+static void glyph_sprite_capture(glyph_sprite_t * sprite, const lv_area_t * clip_area, lv_coord_t pos_x,
+                                 lv_coord_t pos_y);
+#endif
+
 static uint8_t hex_char_to_num(char hex);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+/*Only touched by the first rendering core, the others draw the letters normally*/
+static glyph_sprite_t sprites[LV_GLYPH_SPRITE_CACHE_SIZE];
+static lv_color_t sprite_pool[LV_GLYPH_SPRITE_CACHE_MEM / sizeof(lv_color_t)];
+static uint32_t sprite_cnt;
+static uint32_t sprite_pool_used;
+static lv_glyph_sprite_stats_t sprite_stats;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -395,6 +427,21 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+/**
+ * Get the statistics of the glyph sprite cache
+ * @param stats store the hits, misses and skips here
+ * @param reset true: restart counting from zero
+ */
+void lv_draw_letter_sprite_stats(lv_glyph_sprite_stats_t * stats, bool reset)
+{
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+    *stats = sprite_stats;
+    if(reset) lv_memset_00(&sprite_stats, sizeof(sprite_stats));
+#else
+    lv_memset_00(stats, sizeof(lv_glyph_sprite_stats_t));
+#endif
+}
+
 #if LV_USE_EXTERNAL_RENDERER == 0
 /**********************
  *   STATIC FUNCTIONS
@@ -449,6 +496,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
         return;
     }
 
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+    /*Large glyphs on a plain background are copied from their sprite*/
+    glyph_sprite_t * new_sprite = NULL;
+    if(LV_DRAW_CORE_ID() == 0 && font_p->line_height >= LV_GLYPH_SPRITE_MIN_HEIGHT && !font_p->subpx &&
+       opa == LV_OPA_COVER && blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(glyph_sprite_draw(pos_x, pos_y, &g, clip_area, font_p, letter, color, &new_sprite)) return;
+    }
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(font_p, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -465,6 +521,11 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
     else {
         draw_letter_normal(pos_x, pos_y, &g, clip_area, map_p, color, opa, blend_mode);
     }
+
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+    /*The letter was drawn normally, keep the result for the next time*/
+    if(new_sprite) glyph_sprite_capture(new_sprite, clip_area, pos_x, pos_y);
+#endif
 }
 
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
@@ -504,19 +565,22 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
             return; /*Invalid bpp. Can't render the letter*/
     }
 
-    static lv_opa_t opa_table[256];
-    static lv_opa_t prev_opa = LV_OPA_TRANSP;
-    static uint32_t prev_bpp = 0;
+    /*Every rendering core keeps its own table*/
+    static lv_opa_t opa_tables[LV_DRAW_CORES][256];
+    static lv_opa_t prev_opas[LV_DRAW_CORES] = {LV_OPA_TRANSP};
+    static uint32_t prev_bpps[LV_DRAW_CORES] = {0};
+    uint32_t core = LV_DRAW_CORE_ID();
     if(opa < LV_OPA_MAX) {
-        if(prev_opa != opa || prev_bpp != bpp) {
+        lv_opa_t * opa_table = opa_tables[core];
+        if(prev_opas[core] != opa || prev_bpps[core] != bpp) {
             uint32_t i;
             for(i = 0; i < shades; i++) {
                 opa_table[i] = bpp_opa_table_p[i] == LV_OPA_COVER ? opa : ((bpp_opa_table_p[i] * opa) >> 8);
             }
         }
         bpp_opa_table_p = opa_table;
-        prev_opa = opa;
-        prev_bpp = bpp;
+        prev_opas[core] = opa;
+        prev_bpps[core] = bpp;
     }
 
     int32_t col, row;
@@ -833,6 +897,163 @@ static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
 #endif /*LV_USE_EXTERNAL_RENDERER*/
+#if LV_USE_EXTERNAL_RENDERER == 0 && LV_GLYPH_SPRITE_CACHE_SIZE > 0
+/**
+ * Copy a letter from its sprite if the background under it has a single color
+ * @param pos_x x coordinate of the glyph's box
+ * @param pos_y y coordinate of the glyph's box
+ * @param g the glyph's descriptor
+ * @param clip_area the letter will be drawn only on this area
+ * @param font_p pointer to font
+ * @param letter the letter to draw
+ * @param color color of letter
+ * @param new_sprite set to a reserved sprite if the letter should be drawn normally and then captured
+ * @return true: the letter was copied from its sprite; false: it should be drawn normally
+ */
+static bool glyph_sprite_draw(lv_coord_t pos_x, lv_coord_t pos_y, const lv_font_glyph_dsc_t * g,
+                              const lv_area_t * clip_area, const lv_font_t * font_p, uint32_t letter,
+                              lv_color_t color, glyph_sprite_t ** new_sprite)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp->driver->set_px_cb) return false;
+
+    lv_area_t box;
+    box.x1 = pos_x;
+    box.y1 = pos_y;
+    box.x2 = pos_x + g->box_w - 1;
+    box.y2 = pos_y + g->box_h - 1;
+
+    lv_area_t vis;
+    if(!_lv_area_intersect(&vis, &box, clip_area)) return false;
+
+    /*Masks (e.g. rounded parents) would change the blended pixels*/
+    if(lv_draw_mask_is_any(&vis)) {
+        sprite_stats.skips++;
+        return false;
+    }
+
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    int32_t buf_w = lv_area_get_width(&draw_buf->area);
+    int32_t vis_w = lv_area_get_width(&vis);
+    if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+
+    /*The background color is part of the key so a restyled label just gets new sprites*/
+    lv_color_t * dest = (lv_color_t *)draw_buf->buf_act + buf_w * (vis.y1 - draw_buf->area.y1) +
+                        (vis.x1 - draw_buf->area.x1);
+    lv_color_t bg = dest[0];
+    lv_color_t * row = dest;
+    int32_t x;
+    int32_t y;
+    for(y = vis.y1; y <= vis.y2; y++) {
+        for(x = 0; x < vis_w; x++) {
+            if(row[x].full != bg.full) {
+                sprite_stats.skips++;
+                return false;
+            }
+        }
+        row += buf_w;
+    }
+
+    /*Rows of the box in this draw buffer*/
+    int32_t row1 = vis.y1 - box.y1;
+    int32_t row2 = vis.y2 - box.y1;
+    glyph_sprite_t * s = NULL;
+    uint32_t i;
+    for(i = 0; i < sprite_cnt; i++) {
+        if(sprites[i].font == font_p && sprites[i].letter == letter &&
+           sprites[i].color.full == color.full && sprites[i].bg.full == bg.full) {
+            s = &sprites[i];
+            break;
+        }
+    }
+
+    if(s && row1 >= s->y1 && row2 <= s->y2) {
+        sprite_stats.hits++;
+        const lv_color_t * src = &sprite_pool[s->ofs + s->w * row1 + (vis.x1 - box.x1)];
+        row = dest;
+        for(y = vis.y1; y <= vis.y2; y++) {
+            lv_memcpy(row, src, vis_w * sizeof(lv_color_t));
+            src += s->w;
+            row += buf_w;
+        }
+        return true;
+    }
+
+    sprite_stats.misses++;
+
+    /*A letter crossing the border of the draw buffer is captured row by row in the buffers it's drawn in,
+     *the columns are needed completely*/
+    if(vis.x1 != box.x1 || vis.x2 != box.x2) return false;
+
+    if(s == NULL) {
+        uint32_t px = (uint32_t)g->box_w * g->box_h;
+        uint32_t pool_px = sizeof(sprite_pool) / sizeof(sprite_pool[0]);
+        if(px > pool_px) return false;
+
+        /*Full: start again, the sprites in use are created again in a few refreshes*/
+        if(sprite_cnt == LV_GLYPH_SPRITE_CACHE_SIZE || sprite_pool_used + px > pool_px) {
+            sprite_cnt = 0;
+            sprite_pool_used = 0;
+        }
+
+        s = &sprites[sprite_cnt];
+        s->font = font_p;
+        s->letter = letter;
+        s->color = color;
+        s->bg = bg;
+        s->w = g->box_w;
+        s->h = g->box_h;
+        s->y1 = 0;
+        s->y2 = -1;
+        s->ofs = sprite_pool_used;
+        sprite_cnt++;
+        sprite_pool_used += px;
+    }
+
+    *new_sprite = s;
+    return false;
+}
+
+/**
+ * Save the rows of a letter drawn normally into its sprite
+ * @param sprite the sprite returned by `glyph_sprite_draw`
+ * @param clip_area the letter was drawn only on this area
+ * @param pos_x x coordinate of the glyph's box
+ * @param pos_y y coordinate of the glyph's box
+ */
+static void glyph_sprite_capture(glyph_sprite_t * sprite, const lv_area_t * clip_area, lv_coord_t pos_x,
+                                 lv_coord_t pos_y)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    int32_t buf_w = lv_area_get_width(&draw_buf->area);
+    if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+
+    int32_t row1 = LV_MAX(clip_area->y1 - pos_y, 0);
+    int32_t row2 = LV_MIN(clip_area->y2 - pos_y, sprite->h - 1);
+
+    const lv_color_t * row = (lv_color_t *)draw_buf->buf_act + buf_w * (pos_y + row1 - draw_buf->area.y1) +
+                             (pos_x - draw_buf->area.x1);
+    lv_color_t * dest = &sprite_pool[sprite->ofs + sprite->w * row1];
+    int32_t y;
+    for(y = row1; y <= row2; y++) {
+        lv_memcpy(dest, row, sprite->w * sizeof(lv_color_t));
+        dest += sprite->w;
+        row += buf_w;
+    }
+
+    /*Keep one continuous range of valid rows*/
+    if(sprite->y1 > sprite->y2 || row2 + 1 < sprite->y1 || row1 > sprite->y2 + 1) {
+        sprite->y1 = row1;
+        sprite->y2 = row2;
+    }
+    else {
+        sprite->y1 = LV_MIN(sprite->y1, row1);
+        sprite->y2 = LV_MAX(sprite->y2, row2);
+    }
+}
+#endif /*LV_GLYPH_SPRITE_CACHE_SIZE*/
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
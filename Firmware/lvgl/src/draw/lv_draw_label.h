@@ -63,6 +63,13 @@ typedef struct _lv_draw_label_hint_t {
     int32_t coord_y;
 } lv_draw_label_hint_t;
 
+/** Counters of the glyph sprite cache (`LV_GLYPH_SPRITE_CACHE_SIZE`)*/
+typedef struct {
+    uint32_t hits;      /**< Letters copied from their sprite*/
+    uint32_t misses;    /**< Letters drawn normally and captured (if they were completely visible)*/
+    uint32_t skips;     /**< Letters drawn normally because of a mask or a not plain background*/
+} lv_glyph_sprite_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -87,6 +94,13 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
 LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_area_t * clip_area,
                                           const lv_font_t * font_p,
                                           uint32_t letter, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+
+/**
+ * Get the statistics of the glyph sprite cache
+ * @param stats store the hits, misses and skips here
+ * @param reset true: restart counting from zero
+ */
+void lv_draw_letter_sprite_stats(lv_glyph_sprite_stats_t * stats, bool reset);
 //! @endcond
 /***********************
  * GLOBAL VARIABLES
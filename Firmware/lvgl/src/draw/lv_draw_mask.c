@@ -19,6 +19,10 @@
 #define CIRCLE_CACHE_LIFE_MAX   1000
 #define CIRCLE_CACHE_AGING(life, r)   life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
 
+/*Mask list and circle cache of the core which is drawing*/
+#define MASK_LIST       LV_GC_ROOT(_lv_draw_mask_list)[LV_DRAW_CORE_ID()]
+#define CIRCLE_CACHE    LV_GC_ROOT(_lv_circle_cache)[LV_DRAW_CORE_ID()]
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -80,7 +84,7 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
     /*Look for a free entry*/
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param == NULL) break;
+        if(MASK_LIST[i].param == NULL) break;
     }
 
     if(i >= _LV_MASK_MAX_NUM) {
@@ -88,8 +92,8 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
         return LV_MASK_ID_INV;
     }
 
-    LV_GC_ROOT(_lv_draw_mask_list[i]).param = param;
-    LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id = custom_id;
+    MASK_LIST[i].param = param;
+    MASK_LIST[i].custom_id = custom_id;
 
     return i;
 }
@@ -111,7 +115,7 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf,
     bool changed = false;
     _lv_draw_mask_common_dsc_t * dsc;
 
-    _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list);
+    _lv_draw_mask_saved_t * m = MASK_LIST;
 
     while(m->param) {
         dsc = m->param;
@@ -148,7 +152,7 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply_ids(lv_opa_t * mask_
     for (int i = 0; i < ids_count; i++) {
         int16_t id = ids[i];
         if (id == LV_MASK_ID_INV) continue;
-        dsc = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
+        dsc = MASK_LIST[id].param;
         if (!dsc) continue;
         lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
         res = dsc->cb(mask_buf, abs_x, abs_y, len, dsc);
@@ -170,9 +174,9 @@ void * lv_draw_mask_remove_id(int16_t id)
     _lv_draw_mask_common_dsc_t * p = NULL;
 
     if(id != LV_MASK_ID_INV) {
-        p = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).param = NULL;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).custom_id = NULL;
+        p = MASK_LIST[id].param;
+        MASK_LIST[id].param = NULL;
+        MASK_LIST[id].custom_id = NULL;
     }
 
     return p;
@@ -189,8 +193,8 @@ void * lv_draw_mask_remove_custom(void * custom_id)
     _lv_draw_mask_common_dsc_t * p = NULL;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id == custom_id) {
-            p = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        if(MASK_LIST[i].custom_id == custom_id) {
+            p = MASK_LIST[i].param;
             lv_draw_mask_remove_id(i);
         }
     }
@@ -209,7 +213,8 @@ void lv_draw_mask_free_param(void * p)
     _lv_draw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_MASK_TYPE_RADIUS) {
         lv_draw_mask_radius_param_t * radius_p = (lv_draw_mask_radius_param_t *) p;
-        if(radius_p->circle) {
+        /*Precomputed circles have no `buf` and they are not counted*/
+        if(radius_p->circle && radius_p->circle->buf) {
             if(radius_p->circle->life < 0) {
                 lv_mem_free(radius_p->circle->cir_opa);
                 lv_mem_free(radius_p->circle);
@@ -223,15 +228,30 @@ void lv_draw_mask_free_param(void * p)
 
 void _lv_draw_mask_cleanup(void)
 {
+    uint8_t c;
     uint8_t i;
-    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
+    for(c = 0; c < LV_DRAW_CORES; c++) {
+        _lv_draw_mask_radius_circle_dsc_t * cache = LV_GC_ROOT(_lv_circle_cache)[c];
+        for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+            if(cache[i].buf) {
+                lv_mem_free(cache[i].buf);
+            }
+            lv_memset_00(&cache[i], sizeof(cache[i]));
         }
-        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
     }
 }
 
+/**
+ * Calculate the anti-aliased edge of a circle at run time, even if it has a precomputed table.
+ * Used to generate the tables of `LV_CIRCLE_TABLE_RADII`.
+ * @param c the descriptor to fill. `c->buf` is (re)allocated with `lv_mem_alloc()`
+ * @param radius radius of the circle
+ */
+void _lv_draw_mask_circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius)
+{
+    circ_calc_aa4(c, radius);
+}
+
 /**
  * Count the currently added masks
  * @return number of active masks
@@ -241,21 +261,21 @@ LV_ATTRIBUTE_FAST_MEM uint8_t lv_draw_mask_get_cnt(void)
     uint8_t cnt = 0;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param) cnt++;
+        if(MASK_LIST[i].param) cnt++;
     }
     return cnt;
 }
 
-bool lv_draw_mask_is_any(const lv_area_t * a)
+LV_ATTRIBUTE_FAST_MEM bool lv_draw_mask_is_any(const lv_area_t * a)
 {
-    if(a == NULL) return LV_GC_ROOT(_lv_draw_mask_list[0]).param ? true : false;
+    if(a == NULL) return MASK_LIST[0].param ? true : false;
 
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        _lv_draw_mask_common_dsc_t * comm_param =  LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        _lv_draw_mask_common_dsc_t * comm_param =  MASK_LIST[i].param;
         if(comm_param == NULL) continue;
         if(comm_param->type == LV_DRAW_MASK_TYPE_RADIUS) {
-            lv_draw_mask_radius_param_t * radius_param =  LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+            lv_draw_mask_radius_param_t * radius_param =  MASK_LIST[i].param;
             if(radius_param->cfg.outer) {
                 if(!_lv_area_is_out(a, &radius_param->cfg.rect, radius_param->cfg.radius)) return true;
             }
@@ -488,12 +508,22 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
 
     uint32_t i;
 
+#if LV_USE_CIRCLE_TABLES
+    /*Precomputed circles in flash are shared by the cores, no need to count the references*/
+    for(i = 0; i < _lv_circle_tables_cnt && _lv_circle_tables[i].radius <= radius; i++) {
+        if(_lv_circle_tables[i].radius == radius) {
+            param->circle = (_lv_draw_mask_radius_circle_dsc_t *)&_lv_circle_tables[i];
+            return;
+        }
+    }
+#endif
+
     /*Try to reuse a circle cache entry*/
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).radius == radius) {
-            LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
-            CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
-            param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(CIRCLE_CACHE[i].radius == radius) {
+            CIRCLE_CACHE[i].used_cnt++;
+            CIRCLE_CACHE_AGING(CIRCLE_CACHE[i].life, radius);
+            param->circle = &CIRCLE_CACHE[i];
             return;
         }
     }
@@ -501,9 +531,9 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     /*If not found find a free entry with lowest life*/
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).used_cnt == 0) {
-            if(!entry) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
-            else if(LV_GC_ROOT(_lv_circle_cache[i]).life < entry->life) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(CIRCLE_CACHE[i].used_cnt == 0) {
+            if(!entry) entry = &CIRCLE_CACHE[i];
+            else if(CIRCLE_CACHE[i].life < entry->life) entry = &CIRCLE_CACHE[i];
         }
     }
 
@@ -1403,6 +1433,9 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
         }
         y++;
     }
+    /*End of the last line if it is `radius - 1`: `get_next_line()` reads it. `opa_start_on_y` has
+     *`radius + 1` entries, writing past them would overwrite `x_start_on_y[0]`*/
+    if(y <= radius) c->opa_start_on_y[y] = cir_size;
 
     lv_mem_buf_release(cir_x);
 }
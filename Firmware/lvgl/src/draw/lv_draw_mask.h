@@ -50,7 +50,8 @@ typedef struct {
     void * custom_id;
 } _lv_draw_mask_saved_t;
 
-typedef _lv_draw_mask_saved_t _lv_draw_mask_saved_arr_t[_LV_MASK_MAX_NUM];
+/*Every rendering core has its own mask list*/
+typedef _lv_draw_mask_saved_t _lv_draw_mask_saved_arr_t[LV_DRAW_CORES][_LV_MASK_MAX_NUM];
 
 
 
@@ -165,7 +166,14 @@ typedef struct  {
     lv_coord_t radius;          /*The radius of the entry*/
 } _lv_draw_mask_radius_circle_dsc_t;
 
-typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
+typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_DRAW_CORES][LV_CIRCLE_CACHE_SIZE];
+
+#if LV_USE_CIRCLE_TABLES
+/*Circles precomputed for `LV_CIRCLE_TABLE_RADII`, sorted by radius. They have no `buf` and they are never released.
+ *Generated by the `circle_tables_update` target of the host build.*/
+extern const _lv_draw_mask_radius_circle_dsc_t _lv_circle_tables[];
+extern const uint16_t _lv_circle_tables_cnt;
+#endif
 
 typedef struct {
     /*The first element must be the common descriptor*/
@@ -285,6 +293,14 @@ void lv_draw_mask_free_param(void * p);
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Calculate the anti-aliased edge of a circle at run time, even if it has a precomputed table.
+ * Used to generate the tables of `LV_CIRCLE_TABLE_RADII`.
+ * @param c the descriptor to fill. `c->buf` is (re)allocated with `lv_mem_alloc()`
+ * @param radius radius of the circle
+ */
+void _lv_draw_mask_circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -299,7 +315,7 @@ LV_ATTRIBUTE_FAST_MEM uint8_t lv_draw_mask_get_cnt(void);
  * @param a     an area to test for affecting masks.
  * @return true: there is t least 1 draw mask; false: there are no draw masks
  */
-bool lv_draw_mask_is_any(const lv_area_t * a);
+LV_ATTRIBUTE_FAST_MEM bool lv_draw_mask_is_any(const lv_area_t * a);
 
 //! @endcond
 
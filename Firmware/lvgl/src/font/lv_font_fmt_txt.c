@@ -201,6 +201,24 @@ void _lv_font_clean_up_fmt_txt(void)
 #endif
 }
 
+/**
+ * Get the hit and miss counters of a font's glyph id and kerning cache.
+ * @param font pointer to a font in LVGL's native format
+ * @param stats store the counters here (all 0 if the font has no cache)
+ * @param reset true: restart counting from zero
+ */
+void lv_font_fmt_txt_cache_stats(const lv_font_t * font, lv_font_fmt_txt_cache_stats_t * stats, bool reset)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc->cache == NULL) {
+        lv_memset_00(stats, sizeof(lv_font_fmt_txt_cache_stats_t));
+        return;
+    }
+
+    *stats = fdsc->cache->stats;
+    if(reset) lv_memset_00(&fdsc->cache->stats, sizeof(lv_font_fmt_txt_cache_stats_t));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -211,8 +229,16 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+    /*The cache of the font is shared, only the first rendering core uses it*/
+    lv_font_fmt_txt_glyph_cache_t * cache = LV_DRAW_CORE_ID() == 0 ? fdsc->cache : NULL;
+
     /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    if(cache && letter == cache->last_letter) return cache->last_glyph_id;
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    /*Mix in the upper bits, the symbols are close to each other in the private use area*/
+    uint32_t slot = (letter ^ (letter >> 4)) % LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE;
+#endif
 
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
@@ -228,6 +254,13 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
             glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
         }
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+        /*The sparse lists need a binary search, its results are kept in the cache*/
+        else if(cache && cache->letters[slot] == letter) {
+            cache->stats.glyph_hits++;
+            glyph_id = cache->glyph_ids[slot];
+        }
+#endif
         else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
             uint16_t key = rcp;
             uint16_t * p = _lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
@@ -250,17 +283,26 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+        if(cache && (fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ||
+                     fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) && cache->letters[slot] != letter) {
+            cache->stats.glyph_misses++;
+            cache->letters[slot] = letter;
+            cache->glyph_ids[slot] = glyph_id;
+        }
+#endif
+
         /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
+        if(cache) {
+            cache->last_letter = letter;
+            cache->last_glyph_id = glyph_id;
         }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
+    if(cache) {
+        cache->last_letter = letter;
+        cache->last_glyph_id = 0;
     }
     return 0;
 
@@ -273,6 +315,21 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE > 0
+        /*The pairs need a binary search, its results are kept in the cache.
+         *Same as the glyph ids only the first rendering core uses it. A valid pair is never 0.*/
+        lv_font_fmt_txt_glyph_cache_t * cache = LV_DRAW_CORE_ID() == 0 ? fdsc->cache : NULL;
+        uint32_t pair = (gid_left << 16) | gid_right;
+        uint32_t slot = (gid_left * 31 + gid_right) % LV_FONT_FMT_TXT_KERN_CACHE_SIZE;
+        if(cache) {
+            if(cache->kern_pairs[slot] == pair) {
+                cache->stats.kern_hits++;
+                return cache->kern_values[slot];
+            }
+            cache->stats.kern_misses++;
+        }
+#endif
+
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
         if(kdsc->glyph_ids_size == 0) {
@@ -305,6 +362,13 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
         else {
             /*Invalid value*/
         }
+
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE > 0
+        if(cache) {
+            cache->kern_pairs[slot] = pair;
+            cache->kern_values[slot] = value;
+        }
+#endif
     }
     else {
         /*Kern classes*/
@@ -151,9 +151,28 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/** Counters of a font's glyph cache*/
+typedef struct {
+    uint32_t glyph_hits;
+    uint32_t glyph_misses;
+    uint32_t kern_hits;
+    uint32_t kern_misses;
+} lv_font_fmt_txt_cache_stats_t;
+
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    /*Direct mapped letter -> glyph id, `letters[i] == 0` is an empty slot*/
+    uint32_t letters[LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE];
+    uint32_t glyph_ids[LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE];
+#endif
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE > 0
+    /*Direct mapped (left glyph id << 16 | right glyph id) -> kerning value, 0 is an empty slot*/
+    uint32_t kern_pairs[LV_FONT_FMT_TXT_KERN_CACHE_SIZE];
+    int8_t kern_values[LV_FONT_FMT_TXT_KERN_CACHE_SIZE];
+#endif
+    lv_font_fmt_txt_cache_stats_t stats;
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -225,6 +244,14 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+/**
+ * Get the hit and miss counters of a font's glyph id and kerning cache.
+ * @param font pointer to a font in LVGL's native format
+ * @param stats store the counters here (all 0 if the font has no cache)
+ * @param reset true: restart counting from zero
+ */
+void lv_font_fmt_txt_cache_stats(const lv_font_t * font, lv_font_fmt_txt_cache_stats_t * stats, bool reset);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,241 @@
+/**
+ * @file lv_gpu_rp2040_interp.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_gpu_rp2040_interp.h"
+
+#if LV_USE_GPU_RP2040_INTERP
+
+#include "hardware/interp.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_COLOR_DEPTH != 16
+    #error "Can't use the RP2040 interpolators with LV_COLOR_DEPTH != 16"
+#endif
+
+#if LV_COLOR_SCREEN_TRANSP
+    #error "Can't use the RP2040 interpolators with LV_COLOR_SCREEN_TRANSP 1"
+#endif
+
+/*Opacity of a pixel from its mask value and the overall opacity*/
+#define MASK_OPA(m, opa) ((opa) >= LV_OPA_MAX ? (m) : (m) >= LV_OPA_MAX ? (opa) : (lv_opa_t)(((m) * (opa)) >> 8))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t interp_mix(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t blend_px(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool enabled = true;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Configure the interpolator 0 of the calling core in blend mode.
+ * Every core which renders has to call it once, the interpolators are per core.
+ */
+void lv_gpu_rp2040_interp_init(void)
+{
+    /*Lane 1 interpolates between BASE0 and BASE1 by the low 8 bits of ACCUM1*/
+    interp_config cfg = interp_default_config();
+    interp_config_set_blend(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+
+    cfg = interp_default_config();
+    interp_set_config(interp0, 1, &cfg);
+}
+
+/**
+ * Enable or disable the blending with the interpolators, e.g. to compare it with the software rendering
+ * @param en true: blend with the interpolators (default), false: use LVGL's software rendering
+ */
+void lv_gpu_rp2040_interp_enable(bool en)
+{
+    enabled = en;
+}
+
+/**
+ * Tell whether the blending with the interpolators is enabled
+ * @return true: enabled
+ */
+bool lv_gpu_rp2040_interp_is_enabled(void)
+{
+    return enabled;
+}
+
+/**
+ * Fill an area in the buffer with a color and an opacity, optionally with a mask
+ * @param buf a buffer which should be filled
+ * @param buf_w width of the buffer in pixels
+ * @param color fill color
+ * @param mask 0..255 values describing the opacity of the corresponding pixel. Its width is `fill_w`. NULL: no mask
+ * @param opa overall opacity. 255 in `mask` should mean this opacity.
+ * @param fill_w width to fill in pixels (<= buf_w)
+ * @param fill_h height to fill in pixels
+ * @note `buf_w - fill_w` is offset to the next line after fill
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_gpu_rp2040_interp_fill(lv_color_t * buf, lv_coord_t buf_w, lv_color_t color,
+                                                     const lv_opa_t * mask, lv_opa_t opa, lv_coord_t fill_w,
+                                                     lv_coord_t fill_h)
+{
+    uint32_t c32 = color.full | ((uint32_t)color.full << 16);
+
+    /*The pixels are blended in pairs read and written as one word.
+     *The last pair is kept so a plain background under a constant opacity is blended only once.*/
+    uint32_t last_bg2 = 0;
+    uint32_t last_opa2 = UINT32_MAX;
+    uint32_t last_res2 = 0;
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < fill_h; y++) {
+        x = 0;
+
+        /*The first pixel alone if the row doesn't start on a word*/
+        if((lv_uintptr_t)buf & 0x2) {
+            buf[0] = blend_px(color, buf[0], mask ? MASK_OPA(mask[0], opa) : opa);
+            x = 1;
+        }
+
+        for(; x + 1 < fill_w; x += 2) {
+            lv_opa_t opa0 = mask ? MASK_OPA(mask[x], opa) : opa;
+            lv_opa_t opa1 = mask ? MASK_OPA(mask[x + 1], opa) : opa;
+            uint32_t opa2 = ((uint32_t)opa1 << 8) | opa0;
+            uint32_t * d32 = (uint32_t *)&buf[x];
+
+            if(opa2 == 0) continue;
+            if(opa2 == 0xFFFF) {
+                *d32 = c32;
+                continue;
+            }
+            if(*d32 != last_bg2 || opa2 != last_opa2) {
+                last_bg2 = *d32;
+                last_opa2 = opa2;
+                lv_color_t res0 = blend_px(color, buf[x], opa0);
+                lv_color_t res1 = blend_px(color, buf[x + 1], opa1);
+                last_res2 = res0.full | ((uint32_t)res1.full << 16);
+            }
+            *d32 = last_res2;
+        }
+
+        if(x < fill_w) {
+            buf[x] = blend_px(color, buf[x], mask ? MASK_OPA(mask[x], opa) : opa);
+        }
+
+        buf += buf_w;
+        if(mask) mask += fill_w;
+    }
+}
+
+/**
+ * Blend a map (e.g. RGB image with opacity) to a buffer, optionally with a mask
+ * @param buf a buffer where `map` should be blended
+ * @param buf_w width of the buffer in pixels
+ * @param map an "image" to blend
+ * @param map_w width of the map in pixels
+ * @param mask 0..255 values describing the opacity of the corresponding pixel. Its width is `copy_w`. NULL: no mask
+ * @param opa opacity of `map`. 255 in `mask` should mean this opacity.
+ * @param copy_w width of the area to blend in pixels (<= buf_w)
+ * @param copy_h height of the area to blend in pixels
+ * @note `map_w - copy_w` is offset to the next line after blend
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_gpu_rp2040_interp_blend(lv_color_t * buf, lv_coord_t buf_w, const lv_color_t * map,
+                                                      lv_coord_t map_w, const lv_opa_t * mask, lv_opa_t opa,
+                                                      lv_coord_t copy_w, lv_coord_t copy_h)
+{
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < copy_h; y++) {
+        x = 0;
+
+        /*The first pixel alone if the row doesn't start on a word*/
+        if((lv_uintptr_t)buf & 0x2) {
+            buf[0] = blend_px(map[0], buf[0], mask ? MASK_OPA(mask[0], opa) : opa);
+            x = 1;
+        }
+
+        /*Two pixels per word written, the map might not be aligned so it's read by pixels*/
+        for(; x + 1 < copy_w; x += 2) {
+            lv_opa_t opa0 = mask ? MASK_OPA(mask[x], opa) : opa;
+            lv_opa_t opa1 = mask ? MASK_OPA(mask[x + 1], opa) : opa;
+            if((opa0 | opa1) == 0) continue;
+
+            lv_color_t res0 = blend_px(map[x], buf[x], opa0);
+            lv_color_t res1 = blend_px(map[x + 1], buf[x + 1], opa1);
+            *(uint32_t *)&buf[x] = res0.full | ((uint32_t)res1.full << 16);
+        }
+
+        if(x < copy_w) {
+            buf[x] = blend_px(map[x], buf[x], mask ? MASK_OPA(mask[x], opa) : opa);
+        }
+
+        buf += buf_w;
+        map += map_w;
+        if(mask) mask += copy_w;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Mix two colors channel by channel with the interpolator.
+ * Lane 1 goes from BASE0 (`fg`) to BASE1 (`bg`) by `(255 - opa) / 256` so an opacity of 255 gives exactly `fg`.
+ * @param fg foreground color
+ * @param bg background color
+ * @param opa opacity of `fg`
+ * @return the mixed color
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t interp_mix(lv_color_t fg, lv_color_t bg, lv_opa_t opa)
+{
+    lv_color_t ret;
+
+    interp0->accum[1] = LV_OPA_COVER - opa;
+
+    /*BASE_1AND0 writes BASE0 (lower half) and BASE1 (upper half) at once*/
+    interp0->base01 = ((uint32_t)LV_COLOR_GET_R(bg) << 16) | LV_COLOR_GET_R(fg);
+    LV_COLOR_SET_R(ret, interp0->peek[1]);
+    interp0->base01 = ((uint32_t)LV_COLOR_GET_G(bg) << 16) | LV_COLOR_GET_G(fg);
+    LV_COLOR_SET_G(ret, interp0->peek[1]);
+    interp0->base01 = ((uint32_t)LV_COLOR_GET_B(bg) << 16) | LV_COLOR_GET_B(fg);
+    LV_COLOR_SET_B(ret, interp0->peek[1]);
+
+    return ret;
+}
+
+/**
+ * Blend one pixel
+ * @param fg foreground color
+ * @param bg background color
+ * @param opa opacity of `fg`
+ * @return `bg` if transparent, `fg` if opaque, else the mixed color
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t blend_px(lv_color_t fg, lv_color_t bg, lv_opa_t opa)
+{
+    if(opa >= LV_OPA_MAX) return fg;
+    if(opa <= LV_OPA_MIN) return bg;
+    return interp_mix(fg, bg, opa);
+}
+
+#endif /*LV_USE_GPU_RP2040_INTERP*/
@@ -0,0 +1,90 @@
+/**
+ * @file lv_gpu_rp2040_interp.h
+ *
+ */
+
+#ifndef LV_GPU_RP2040_INTERP_H
+#define LV_GPU_RP2040_INTERP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_area.h"
+#include "../misc/lv_color.h"
+
+#if LV_USE_GPU_RP2040_INTERP
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Configure the interpolator 0 of the calling core in blend mode.
+ * Every core which renders has to call it once, the interpolators are per core.
+ */
+void lv_gpu_rp2040_interp_init(void);
+
+/**
+ * Enable or disable the blending with the interpolators, e.g. to compare it with the software rendering
+ * @param en true: blend with the interpolators (default), false: use LVGL's software rendering
+ */
+void lv_gpu_rp2040_interp_enable(bool en);
+
+/**
+ * Tell whether the blending with the interpolators is enabled
+ * @return true: enabled
+ */
+bool lv_gpu_rp2040_interp_is_enabled(void);
+
+/**
+ * Fill an area in the buffer with a color and an opacity, optionally with a mask
+ * @param buf a buffer which should be filled
+ * @param buf_w width of the buffer in pixels
+ * @param color fill color
+ * @param mask 0..255 values describing the opacity of the corresponding pixel. Its width is `fill_w`. NULL: no mask
+ * @param opa overall opacity. 255 in `mask` should mean this opacity.
+ * @param fill_w width to fill in pixels (<= buf_w)
+ * @param fill_h height to fill in pixels
+ * @note `buf_w - fill_w` is offset to the next line after fill
+ */
+void lv_gpu_rp2040_interp_fill(lv_color_t * buf, lv_coord_t buf_w, lv_color_t color, const lv_opa_t * mask,
+                               lv_opa_t opa, lv_coord_t fill_w, lv_coord_t fill_h);
+
+/**
+ * Blend a map (e.g. RGB image with opacity) to a buffer, optionally with a mask
+ * @param buf a buffer where `map` should be blended
+ * @param buf_w width of the buffer in pixels
+ * @param map an "image" to blend
+ * @param map_w width of the map in pixels
+ * @param mask 0..255 values describing the opacity of the corresponding pixel. Its width is `copy_w`. NULL: no mask
+ * @param opa opacity of `map`. 255 in `mask` should mean this opacity.
+ * @param copy_w width of the area to blend in pixels (<= buf_w)
+ * @param copy_h height of the area to blend in pixels
+ * @note `map_w - copy_w` is offset to the next line after blend
+ */
+void lv_gpu_rp2040_interp_blend(lv_color_t * buf, lv_coord_t buf_w, const lv_color_t * map, lv_coord_t map_w,
+                                const lv_opa_t * mask, lv_opa_t opa, lv_coord_t copy_w, lv_coord_t copy_h);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_GPU_RP2040_INTERP*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GPU_RP2040_INTERP_H*/
@@ -96,6 +96,8 @@ typedef struct _lv_disp_drv_t {
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
     uint32_t screen_transp : 1;      /**Handle if the screen doesn't have a solid (opa == LV_OPA_COVER) background.
                                        * Use only if required because it's slower.*/
+    uint32_t circle_clip : 1;        /**< 1: the display is round, don't render the pixels outside the circle
+                                       * inscribed in `hor_res` x `ver_res`*/
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
@@ -135,6 +137,21 @@ typedef struct _lv_disp_drv_t {
     void (*gpu_fill_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
                         const lv_area_t * fill_area, lv_color_t color);
 
+    /** OPTIONAL: Copy opaque pixels to an area of a memory (GPU only). `src_buf` points to the first pixel to copy.
+     * It might be a temporary buffer which is overwritten right after the call, copy it before returning
+     * unless it's known to stay valid until `gpu_wait_cb`.*/
+    void (*gpu_copy_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
+                        const lv_area_t * copy_area, const lv_color_t * src_buf, lv_coord_t src_width);
+
+#if LV_DRAW_CORES > 1
+    /** OPTIONAL: Start `render_cb(param)` on the other core. It renders a band of the draw buffer.
+     * Return false if the core is not available, the band is rendered by the calling core then.*/
+    bool (*render_start_cb)(struct _lv_disp_drv_t * disp_drv, void (*render_cb)(void * param), void * param);
+
+    /** OPTIONAL: Wait until the `render_cb` started by `render_start_cb` returns*/
+    void (*render_wait_cb)(struct _lv_disp_drv_t * disp_drv);
+#endif
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
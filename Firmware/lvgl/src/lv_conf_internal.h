@@ -181,6 +181,17 @@
 #  endif
 #endif
 
+/*Cut the intermediate buffers from a static arena of this many bytes (per rendering core) instead of the heap.
+ *The arena is emptied at once after each refresh so drawing doesn't fragment the memory of the objects.
+ *If the arena is full the buffer is allocated in the heap. 0 to disable*/
+#ifndef LV_MEM_BUF_ARENA_SIZE
+#  ifdef CONFIG_LV_MEM_BUF_ARENA_SIZE
+#    define LV_MEM_BUF_ARENA_SIZE CONFIG_LV_MEM_BUF_ARENA_SIZE
+#  else
+#    define LV_MEM_BUF_ARENA_SIZE 0
+#  endif
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #ifndef LV_MEMCPY_MEMSET_STD
 #  ifdef CONFIG_LV_MEMCPY_MEMSET_STD
@@ -238,6 +249,54 @@
 #endif
 #endif   /*LV_TICK_CUSTOM*/
 
+/*Number of cores rendering a refreshed area in parallel (1 or 2).
+ *The area is split in horizontal bands and the driver's `render_start_cb` / `render_wait_cb`
+ *run the extra bands on the other core. The drawing state is kept per core, the heap is locked.*/
+#ifndef LV_DRAW_CORES
+#  ifdef CONFIG_LV_DRAW_CORES
+#    define LV_DRAW_CORES CONFIG_LV_DRAW_CORES
+#  else
+#    define LV_DRAW_CORES 1
+#  endif
+#endif
+#if LV_DRAW_CORES > 1
+#ifndef LV_DRAW_CORES_INCLUDE
+#  ifdef CONFIG_LV_DRAW_CORES_INCLUDE
+#    define LV_DRAW_CORES_INCLUDE CONFIG_LV_DRAW_CORES_INCLUDE
+#  else
+#    define LV_DRAW_CORES_INCLUDE "hardware/sync.h"    /*Header for the core id and lock functions*/
+#  endif
+#endif
+#ifndef LV_DRAW_CORE_ID_EXPR
+#  ifdef CONFIG_LV_DRAW_CORE_ID_EXPR
+#    define LV_DRAW_CORE_ID_EXPR CONFIG_LV_DRAW_CORE_ID_EXPR
+#  else
+#    define LV_DRAW_CORE_ID_EXPR (get_core_num())      /*Expression evaluating to the id (0..LV_DRAW_CORES-1) of the running core*/
+#  endif
+#endif
+#ifndef LV_DRAW_LOCK_EXPR
+#  ifdef CONFIG_LV_DRAW_LOCK_EXPR
+#    define LV_DRAW_LOCK_EXPR CONFIG_LV_DRAW_LOCK_EXPR
+#  else
+#    define LV_DRAW_LOCK_EXPR (spin_lock_unsafe_blocking(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#  endif
+#endif
+#ifndef LV_DRAW_UNLOCK_EXPR
+#  ifdef CONFIG_LV_DRAW_UNLOCK_EXPR
+#    define LV_DRAW_UNLOCK_EXPR CONFIG_LV_DRAW_UNLOCK_EXPR
+#  else
+#    define LV_DRAW_UNLOCK_EXPR (spin_unlock_unsafe(spin_lock_instance(PICO_SPINLOCK_ID_OS1)))
+#  endif
+#endif
+#ifndef LV_DRAW_CORES_MIN_HEIGHT
+#  ifdef CONFIG_LV_DRAW_CORES_MIN_HEIGHT
+#    define LV_DRAW_CORES_MIN_HEIGHT CONFIG_LV_DRAW_CORES_MIN_HEIGHT
+#  else
+#    define LV_DRAW_CORES_MIN_HEIGHT 8                 /*Don't split areas lower than this*/
+#  endif
+#endif
+#endif   /*LV_DRAW_CORES*/
+
 /*Default Dot Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #ifndef LV_DPI_DEF
@@ -294,8 +353,74 @@
 #  endif
 #endif
 
+/*Use circle data precomputed at build time for the radiuses in LV_CIRCLE_TABLE_RADII (sorted, ascending).
+ *The tables are kept in flash and don't use the cache above*/
+#ifndef LV_USE_CIRCLE_TABLES
+#  ifdef CONFIG_LV_USE_CIRCLE_TABLES
+#    define LV_USE_CIRCLE_TABLES CONFIG_LV_USE_CIRCLE_TABLES
+#  else
+#    define LV_USE_CIRCLE_TABLES 0
+#  endif
+#endif
+#if LV_USE_CIRCLE_TABLES
+#ifndef LV_CIRCLE_TABLE_RADII
+#  ifdef CONFIG_LV_CIRCLE_TABLE_RADII
+#    define LV_CIRCLE_TABLE_RADII CONFIG_LV_CIRCLE_TABLE_RADII
+#  else
+#    define LV_CIRCLE_TABLE_RADII 4, 8, 10
+#  endif
+#endif
+#endif
+
+/*Keep the coverage of the rings drawn by `lv_draw_arc()` (one quarter per radius and width).
+ *A changed arc value then only sweeps the angle mask over the cached ring instead of evaluating two radius masks.
+ *LV_ARC_RING_CACHE_SIZE: max. number of rings per rendering core, 0 to disable
+ *LV_ARC_RING_CACHE_MEM: bytes reserved per rendering core*/
+#ifndef LV_ARC_RING_CACHE_SIZE
+#  ifdef CONFIG_LV_ARC_RING_CACHE_SIZE
+#    define LV_ARC_RING_CACHE_SIZE CONFIG_LV_ARC_RING_CACHE_SIZE
+#  else
+#    define LV_ARC_RING_CACHE_SIZE 0
+#  endif
+#endif
+#ifndef LV_ARC_RING_CACHE_MEM
+#  ifdef CONFIG_LV_ARC_RING_CACHE_MEM
+#    define LV_ARC_RING_CACHE_MEM CONFIG_LV_ARC_RING_CACHE_MEM
+#  else
+#    define LV_ARC_RING_CACHE_MEM (4U * 1024U)
+#  endif
+#endif
+
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Keep pre-blended sprites of large glyphs (e.g. the digits of a clock).
+ *A letter drawn on a plain background is copied row by row from its sprite instead of being blended again.
+ *The sprites are keyed by font, letter, color and background color so a style change just creates new ones.
+ *LV_GLYPH_SPRITE_CACHE_SIZE: max. number of sprites, 0 to disable
+ *LV_GLYPH_SPRITE_CACHE_MEM: bytes reserved for the sprites' pixels
+ *LV_GLYPH_SPRITE_MIN_HEIGHT: only fonts with at least this line height are cached*/
+#ifndef LV_GLYPH_SPRITE_CACHE_SIZE
+#  ifdef CONFIG_LV_GLYPH_SPRITE_CACHE_SIZE
+#    define LV_GLYPH_SPRITE_CACHE_SIZE CONFIG_LV_GLYPH_SPRITE_CACHE_SIZE
+#  else
+#    define LV_GLYPH_SPRITE_CACHE_SIZE 0
+#  endif
+#endif
+#ifndef LV_GLYPH_SPRITE_CACHE_MEM
+#  ifdef CONFIG_LV_GLYPH_SPRITE_CACHE_MEM
+#    define LV_GLYPH_SPRITE_CACHE_MEM CONFIG_LV_GLYPH_SPRITE_CACHE_MEM
+#  else
+#    define LV_GLYPH_SPRITE_CACHE_MEM (20U * 1024U)
+#  endif
+#endif
+#ifndef LV_GLYPH_SPRITE_MIN_HEIGHT
+#  ifdef CONFIG_LV_GLYPH_SPRITE_MIN_HEIGHT
+#    define LV_GLYPH_SPRITE_MIN_HEIGHT CONFIG_LV_GLYPH_SPRITE_MIN_HEIGHT
+#  else
+#    define LV_GLYPH_SPRITE_MIN_HEIGHT 40
+#  endif
+#endif
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -342,6 +467,16 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #endif
 #endif
 
+/*Blend with the interpolators of the RP2040 (lv_gpu_rp2040_interp.c).
+ *Every rendering core has to call lv_gpu_rp2040_interp_init() once.*/
+#ifndef LV_USE_GPU_RP2040_INTERP
+#  ifdef CONFIG_LV_USE_GPU_RP2040_INTERP
+#    define LV_USE_GPU_RP2040_INTERP CONFIG_LV_USE_GPU_RP2040_INTERP
+#  else
+#    define LV_USE_GPU_RP2040_INTERP 0
+#  endif
+#endif
+
 /*Use NXP's PXP GPU iMX RTxxx platforms*/
 #ifndef LV_USE_GPU_NXP_PXP
 #  ifdef CONFIG_LV_USE_GPU_NXP_PXP
@@ -1064,6 +1199,26 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  endif
 #endif
 
+/*Cache the results of the binary searches of each font (direct mapped): the glyph ids of the letters
+ *in sparse character maps (e.g. the symbols) and the values of fonts kerned by pairs.
+ *The ASCII range and kerning classes (used by the built-in fonts) are read directly and not cached.
+ *LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE: letters per font, 8 bytes each, 0 to cache only the last letter
+ *LV_FONT_FMT_TXT_KERN_CACHE_SIZE: kerning pairs per font, 5 bytes each, 0 to disable*/
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+#  ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+#    define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+#  else
+#    define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+#  endif
+#endif
+#ifndef LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+#  ifdef CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+#    define LV_FONT_FMT_TXT_KERN_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+#  else
+#    define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+#  endif
+#endif
+
 /*Enables/disables support for compressed fonts.*/
 #ifndef LV_USE_FONT_COMPRESSED
 #  ifdef CONFIG_LV_USE_FONT_COMPRESSED
@@ -1921,6 +2076,18 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 LV_EXPORT_CONST_INT(LV_DPI_DEF);
 
+/*Id of the core running the drawing and lock of the data shared by the rendering cores*/
+#if LV_DRAW_CORES > 1
+#  include LV_DRAW_CORES_INCLUDE
+#  define LV_DRAW_CORE_ID() (LV_DRAW_CORE_ID_EXPR)
+#  define LV_DRAW_LOCK()    LV_DRAW_LOCK_EXPR
+#  define LV_DRAW_UNLOCK()  LV_DRAW_UNLOCK_EXPR
+#else
+#  define LV_DRAW_CORE_ID() 0
+#  define LV_DRAW_LOCK()
+#  define LV_DRAW_UNLOCK()
+#endif
+
 #undef _LV_KCONFIG_PRESENT
 
 /*If running without lv_conf.h add typdesf with default value*/
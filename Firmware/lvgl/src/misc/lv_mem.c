@@ -39,9 +39,23 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+/*Temporal buffers of the core which is drawing*/
+#define MEM_BUF            LV_GC_ROOT(lv_mem_buf)[LV_DRAW_CORE_ID()]
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_BUF_ARENA_SIZE > 0
+/*The temporal buffers of a rendering core are cut from the start of its arena
+ *and all of them are given back at once by `lv_mem_buf_free_all()` after each refresh,
+ *so drawing never leaves holes in the heap of the objects.*/
+typedef struct {
+    uint32_t used;          /*Bytes cut since the last `lv_mem_buf_free_all()`*/
+    uint32_t high_water;
+    uint32_t fallbacks;
+    MEM_UNIT mem[LV_MEM_BUF_ARENA_SIZE / sizeof(MEM_UNIT)];
+} mem_buf_arena_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,6 +63,9 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#if LV_MEM_BUF_ARENA_SIZE > 0
+    static void * mem_buf_arena_cut(lv_mem_buf_t * buf, uint32_t size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -59,6 +76,10 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_MEM_BUF_ARENA_SIZE > 0
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY mem_buf_arena_t mem_buf_arenas[LV_DRAW_CORES];
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -128,11 +149,13 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
+    LV_DRAW_LOCK();
 #if LV_MEM_CUSTOM == 0
     void * alloc = lv_tlsf_malloc(tlsf, size);
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
+    LV_DRAW_UNLOCK();
 
     if(alloc == NULL) {
         LV_LOG_ERROR("couldn't allocate memory (%lu bytes)", (unsigned long)size);
@@ -166,9 +189,13 @@ void lv_mem_free(void * data)
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
+    LV_DRAW_LOCK();
     lv_tlsf_free(tlsf, data);
+    LV_DRAW_UNLOCK();
 #else
+    LV_DRAW_LOCK();
     LV_MEM_CUSTOM_FREE(data);
+    LV_DRAW_UNLOCK();
 #endif
 }
 
@@ -190,11 +217,13 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+    LV_DRAW_LOCK();
 #if LV_MEM_CUSTOM == 0
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
+    LV_DRAW_UNLOCK();
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't allocate memory");
         return NULL;
@@ -268,41 +297,54 @@ void * lv_mem_buf_get(uint32_t size)
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
+        if(MEM_BUF[i].used == 0 && MEM_BUF[i].size >= size) {
+            if(MEM_BUF[i].size == size) {
+                MEM_BUF[i].used = 1;
+                return MEM_BUF[i].p;
             }
             else if(i_guess < 0) {
                 i_guess = i;
             }
             /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
+            else if(MEM_BUF[i].size < MEM_BUF[i_guess].size) {
                 i_guess = i;
             }
         }
     }
 
     if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
+        MEM_BUF[i_guess].used = 1;
         MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
-                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+                  MEM_BUF[i_guess].p);
+        return MEM_BUF[i_guess].p;
     }
 
     /*Reallocate a free buffer*/
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
+        if(MEM_BUF[i].used == 0) {
+#if LV_MEM_BUF_ARENA_SIZE > 0
+            void * buf = mem_buf_arena_cut(&MEM_BUF[i], size);
+            if(buf) {
+                if(MEM_BUF[i].p && !MEM_BUF[i].arena) lv_mem_free(MEM_BUF[i].p);
+                MEM_BUF[i].arena = 1;
+            }
+            else {
+                /*The arena is full, use the heap. The old content needn't be kept so don't reallocate an arena buffer*/
+                buf = lv_mem_realloc(MEM_BUF[i].arena ? NULL : MEM_BUF[i].p, size);
+                MEM_BUF[i].arena = 0;
+            }
+#else
+            void * buf = lv_mem_realloc(MEM_BUF[i].p, size);
+#endif
             /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
             LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
             if(buf == NULL) return NULL;
 
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
+            MEM_BUF[i].used = 1;
+            MEM_BUF[i].size = size;
+            MEM_BUF[i].p    = buf;
+            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, MEM_BUF[i].p);
+            return MEM_BUF[i].p;
         }
     }
 
@@ -320,8 +362,8 @@ void lv_mem_buf_release(void * p)
     MEM_TRACE("begin (address: %p)", p);
 
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
+        if(MEM_BUF[i].p == p) {
+            MEM_BUF[i].used = 0;
             return;
         }
     }
@@ -334,14 +376,45 @@ void lv_mem_buf_release(void * p)
  */
 void lv_mem_buf_free_all(void)
 {
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
-            lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
-            LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            LV_GC_ROOT(lv_mem_buf[i]).size = 0;
+    for(uint8_t c = 0; c < LV_DRAW_CORES; c++) {
+        lv_mem_buf_t * bufs = LV_GC_ROOT(lv_mem_buf)[c];
+        for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
+            if(bufs[i].p) {
+                if(!bufs[i].arena) lv_mem_free(bufs[i].p);
+                bufs[i].p = NULL;
+                bufs[i].used = 0;
+                bufs[i].size = 0;
+                bufs[i].arena = 0;
+            }
+        }
+#if LV_MEM_BUF_ARENA_SIZE > 0
+        mem_buf_arenas[c].used = 0;
+#endif
+    }
+}
+
+/**
+ * Get the statistics of the temporal buffers' arena.
+ * The high-water mark is the one of the fullest rendering core, the fallbacks are summed.
+ * @param stats store the size, the high-water mark and the fallbacks to the heap here
+ * @param reset true: restart counting from zero
+ */
+void lv_mem_buf_arena_stats(lv_mem_buf_arena_stats_t * stats, bool reset)
+{
+    lv_memset_00(stats, sizeof(lv_mem_buf_arena_stats_t));
+#if LV_MEM_BUF_ARENA_SIZE > 0
+    stats->size = sizeof(mem_buf_arenas[0].mem);
+    for(uint8_t c = 0; c < LV_DRAW_CORES; c++) {
+        if(mem_buf_arenas[c].high_water > stats->high_water) stats->high_water = mem_buf_arenas[c].high_water;
+        stats->fallbacks += mem_buf_arenas[c].fallbacks;
+        if(reset) {
+            mem_buf_arenas[c].high_water = mem_buf_arenas[c].used;
+            mem_buf_arenas[c].fallbacks = 0;
         }
     }
+#else
+    LV_UNUSED(reset);
+#endif
 }
 
 #if LV_MEMCPY_MEMSET_STD == 0
@@ -550,3 +623,33 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_BUF_ARENA_SIZE > 0
+/**
+ * Cut a buffer from the arena of the rendering core
+ * @param buf the free buffer which will get the memory
+ * @param size the required size
+ * @return pointer to the memory or NULL if the arena is full
+ */
+static void * mem_buf_arena_cut(lv_mem_buf_t * buf, uint32_t size)
+{
+    mem_buf_arena_t * arena = &mem_buf_arenas[LV_DRAW_CORE_ID()];
+    uint8_t * mem = (uint8_t *)arena->mem;
+    uint32_t start = arena->used;
+
+    /*If the buffer was the last one cut it can grow in place. Its content needn't be kept.*/
+    if(buf->arena && (uint8_t *)buf->p + ((buf->size + ALIGN_MASK) & ~ALIGN_MASK) == mem + arena->used) {
+        start = (uint8_t *)buf->p - mem;
+    }
+
+    uint32_t end = start + ((size + ALIGN_MASK) & ~ALIGN_MASK);
+    if(end > sizeof(arena->mem)) {
+        arena->fallbacks++;
+        return NULL;
+    }
+
+    arena->used = end;
+    if(end > arena->high_water) arena->high_water = end;
+    return mem + start;
+}
+#endif
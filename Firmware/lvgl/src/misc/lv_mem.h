@@ -16,6 +16,7 @@ extern "C" {
 #include "../lv_conf_internal.h"
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -47,9 +48,18 @@ typedef struct {
     void * p;
     uint16_t size;
     uint8_t used : 1;
+    uint8_t arena : 1;  /**< `p` was cut from the arena of `LV_MEM_BUF_ARENA_SIZE`, not allocated in the heap*/
 } lv_mem_buf_t;
 
-typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
+/** Counters of the temporal buffers' arena (`LV_MEM_BUF_ARENA_SIZE`)*/
+typedef struct {
+    uint32_t size;          /**< Bytes of the arena of each rendering core*/
+    uint32_t high_water;    /**< Max. bytes cut from an arena between two `lv_mem_buf_free_all()`*/
+    uint32_t fallbacks;     /**< Buffers allocated in the heap because the arena was full*/
+} lv_mem_buf_arena_stats_t;
+
+/*Every rendering core has its own buffers*/
+typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_DRAW_CORES][LV_MEM_BUF_MAX_NUM];
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -119,6 +129,14 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+/**
+ * Get the statistics of the temporal buffers' arena.
+ * The high-water mark is the one of the fullest rendering core, the fallbacks are summed.
+ * @param stats store the size, the high-water mark and the fallbacks to the heap here
+ * @param reset true: restart counting from zero
+ */
+void lv_mem_buf_arena_stats(lv_mem_buf_arena_stats_t * stats, bool reset);
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
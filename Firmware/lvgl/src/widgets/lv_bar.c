@@ -262,23 +262,25 @@ static void draw_indic(lv_event_t * e)
     lv_coord_t bg_top = lv_obj_get_style_pad_top(obj,       LV_PART_MAIN);
     lv_coord_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
     /*Respect padding and minimum width/height too*/
-    lv_area_copy(&bar->indic_area, &bar_coords);
-    bar->indic_area.x1 += bg_left;
-    bar->indic_area.x2 -= bg_right;
-    bar->indic_area.y1 += bg_top;
-    bar->indic_area.y2 -= bg_bottom;
-
-    if(hor && lv_area_get_height(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.y2 = bar->indic_area.y1 + LV_BAR_SIZE_MIN;
+    /*Work on a local area because the bar can be drawn by more rendering cores at once*/
+    lv_area_t indic_area;
+    lv_area_copy(&indic_area, &bar_coords);
+    indic_area.x1 += bg_left;
+    indic_area.x2 -= bg_right;
+    indic_area.y1 += bg_top;
+    indic_area.y2 -= bg_bottom;
+
+    if(hor && lv_area_get_height(&indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area.y2 = indic_area.y1 + LV_BAR_SIZE_MIN;
     }
-    else if(!hor && lv_area_get_width(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.x2 = bar->indic_area.x1 + LV_BAR_SIZE_MIN;
+    else if(!hor && lv_area_get_width(&indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area.x2 = indic_area.x1 + LV_BAR_SIZE_MIN;
     }
 
-    lv_coord_t indicw = lv_area_get_width(&bar->indic_area);
-    lv_coord_t indich = lv_area_get_height(&bar->indic_area);
+    lv_coord_t indicw = lv_area_get_width(&indic_area);
+    lv_coord_t indich = lv_area_get_height(&indic_area);
 
     /*Calculate the indicator length*/
     lv_coord_t anim_length = hor ? indicw : indich;
@@ -289,13 +291,13 @@ static void draw_indic(lv_event_t * e)
     lv_coord_t (*indic_length_calc)(const lv_area_t * area);
 
     if(hor) {
-        axis1 = &bar->indic_area.x1;
-        axis2 = &bar->indic_area.x2;
+        axis1 = &indic_area.x1;
+        axis2 = &indic_area.x2;
         indic_length_calc = lv_area_get_width;
     }
     else {
-        axis1 = &bar->indic_area.y1;
-        axis2 = &bar->indic_area.y2;
+        axis1 = &indic_area.y1;
+        axis2 = &indic_area.y2;
         indic_length_calc = lv_area_get_height;
     }
 
@@ -377,15 +379,17 @@ static void draw_indic(lv_event_t * e)
         }
     }
 
+    lv_area_copy(&bar->indic_area, &indic_area);
+
     /*Do not draw a zero length indicator but at least call the draw part events*/
-    if(!sym && indic_length_calc(&bar->indic_area) <= 1) {
+    if(!sym && indic_length_calc(&indic_area) <= 1) {
 
         lv_obj_draw_part_dsc_t part_draw_dsc;
         lv_obj_draw_dsc_init(&part_draw_dsc, clip_area);
         part_draw_dsc.part = LV_PART_INDICATOR;
         part_draw_dsc.class_p = MY_CLASS;
         part_draw_dsc.type = LV_BAR_DRAW_PART_INDICATOR;
-        part_draw_dsc.draw_area = &bar->indic_area;
+        part_draw_dsc.draw_area = &indic_area;
 
         lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
@@ -396,9 +400,6 @@ static void draw_indic(lv_event_t * e)
     lv_coord_t short_side = LV_MIN(barw, barh);
     if(bg_radius > short_side >> 1) bg_radius = short_side >> 1;
 
-    lv_area_t indic_area;
-    lv_area_copy(&indic_area, &bar->indic_area);
-
     lv_draw_rect_dsc_t draw_rect_dsc;
     lv_draw_rect_dsc_init(&draw_rect_dsc);
     lv_obj_init_draw_rect_dsc(obj, LV_PART_INDICATOR, &draw_rect_dsc);
@@ -409,15 +410,15 @@ static void draw_indic(lv_event_t * e)
     part_draw_dsc.class_p = MY_CLASS;
     part_draw_dsc.type = LV_BAR_DRAW_PART_INDICATOR;
     part_draw_dsc.rect_dsc = &draw_rect_dsc;
-    part_draw_dsc.draw_area = &bar->indic_area;
+    part_draw_dsc.draw_area = &indic_area;
 
     lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
 
     /*Draw only the shadow if the indicator is long enough.
      *The radius of the bg and the indicator can make a strange shape where
      *it'd be very difficult to draw shadow.*/
-    if((hor && lv_area_get_width(&bar->indic_area) > bg_radius * 2) ||
-       (!hor && lv_area_get_height(&bar->indic_area) > bg_radius * 2)) {
+    if((hor && lv_area_get_width(&indic_area) > bg_radius * 2) ||
+       (!hor && lv_area_get_height(&indic_area) > bg_radius * 2)) {
         lv_opa_t bg_opa = draw_rect_dsc.bg_opa;
         lv_opa_t bg_img_opa = draw_rect_dsc.bg_img_opa;
         lv_opa_t border_opa = draw_rect_dsc.border_opa;
@@ -425,7 +426,7 @@ static void draw_indic(lv_event_t * e)
         draw_rect_dsc.bg_img_opa = LV_OPA_TRANSP;
         draw_rect_dsc.border_opa = LV_OPA_TRANSP;
 
-        lv_draw_rect(&bar->indic_area, clip_area, &draw_rect_dsc);
+        lv_draw_rect(&indic_area, clip_area, &draw_rect_dsc);
 
         draw_rect_dsc.bg_opa = bg_opa;
         draw_rect_dsc.bg_img_opa = bg_img_opa;
@@ -469,7 +470,7 @@ static void draw_indic(lv_event_t * e)
 #if LV_DRAW_COMPLEX
     /*Create a mask to the current indicator area to see only this part from the whole gradient.*/
     lv_draw_mask_radius_param_t mask_indic_param;
-    lv_draw_mask_radius_init(&mask_indic_param, &bar->indic_area, draw_rect_dsc.radius, false);
+    lv_draw_mask_radius_init(&mask_indic_param, &indic_area, draw_rect_dsc.radius, false);
     int16_t mask_indic_id = lv_draw_mask_add(&mask_indic_param, NULL);
 #endif
 
@@ -481,7 +482,7 @@ static void draw_indic(lv_event_t * e)
     draw_rect_dsc.bg_opa = LV_OPA_TRANSP;
     draw_rect_dsc.bg_img_opa = LV_OPA_TRANSP;
     draw_rect_dsc.shadow_opa = LV_OPA_TRANSP;
-    lv_draw_rect(&bar->indic_area, clip_area, &draw_rect_dsc);
+    lv_draw_rect(&indic_area, clip_area, &draw_rect_dsc);
 
 #if LV_DRAW_COMPLEX
     lv_draw_mask_free_param(&mask_indic_param);
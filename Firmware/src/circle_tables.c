@@ -0,0 +1,143 @@
+/**
+ * @file circle_tables.c
+ *
+ * @brief Círculos con antialiasing precalculados para los radios de LV_CIRCLE_TABLE_RADII.
+ *
+ * Generado por host/circle_tables_gen.c con el target circle_tables_update, no editar.
+ */
+
+#include "../lvgl/lvgl.h"
+
+#if LV_USE_CIRCLE_TABLES
+
+static const lv_opa_t circle_opa_2[4] = {
+    0, 224, 80, 224
+};
+static const uint16_t circle_opa_start_2[3] = {
+    0, 2, 4
+};
+static const uint16_t circle_x_start_2[2] = {
+    1, 0
+};
+
+static const lv_opa_t circle_opa_10[17] = {
+    0, 0, 224, 160, 80, 0, 224, 64, 128, 0, 128, 64, 224, 0, 80, 160,
+    224
+};
+static const uint16_t circle_opa_start_10[11] = {
+    0, 1, 3, 4, 5, 7, 8, 9, 11, 13, 17
+};
+static const uint16_t circle_x_start_10[10] = {
+    10, 9, 9, 9, 8, 8, 7, 6, 4, 1
+};
+
+static const lv_opa_t circle_opa_11[19] = {
+    0, 0, 224, 176, 96, 16, 240, 128, 0, 208, 224, 208, 0, 128, 240, 16,
+    96, 176, 224
+};
+static const uint16_t circle_opa_start_11[12] = {
+    0, 1, 3, 4, 5, 7, 8, 10, 11, 12, 15, 19
+};
+static const uint16_t circle_x_start_11[11] = {
+    11, 10, 10, 10, 9, 9, 8, 7, 6, 4, 1
+};
+
+static const lv_opa_t circle_opa_12[19] = {
+    0, 0, 224, 176, 112, 32, 160, 16, 240, 64, 112, 64, 240, 16, 160, 32,
+    112, 176, 224
+};
+static const uint16_t circle_opa_start_12[13] = {
+    0, 1, 3, 4, 5, 6, 7, 9, 10, 11, 13, 15, 19
+};
+static const uint16_t circle_x_start_12[12] = {
+    12, 11, 11, 11, 11, 10, 9, 9, 8, 6, 5, 1
+};
+
+static const lv_opa_t circle_opa_13[23] = {
+    0, 0, 240, 192, 112, 32, 0, 192, 48, 128, 0, 176, 16, 176, 0, 128,
+    48, 192, 0, 32, 112, 192, 240
+};
+static const uint16_t circle_opa_start_13[14] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 10, 12, 14, 16, 18, 23
+};
+static const uint16_t circle_x_start_13[13] = {
+    13, 12, 12, 12, 12, 11, 11, 10, 9, 8, 7, 5, 1
+};
+
+static const lv_opa_t circle_opa_14[25] = {
+    0, 0, 240, 192, 128, 48, 0, 224, 96, 0, 192, 32, 240, 240, 240, 32,
+    192, 0, 96, 224, 0, 48, 128, 192, 240
+};
+static const uint16_t circle_opa_start_14[15] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 11, 13, 14, 15, 17, 20, 25
+};
+static const uint16_t circle_x_start_14[14] = {
+    14, 13, 13, 13, 13, 12, 12, 11, 10, 9, 8, 7, 5, 1
+};
+
+static const lv_opa_t circle_opa_15[25] = {
+    0, 0, 240, 192, 144, 80, 0, 224, 128, 16, 224, 64, 128, 160, 128, 64,
+    224, 16, 128, 224, 0, 80, 144, 192, 240
+};
+static const uint16_t circle_opa_start_15[16] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 11, 12, 13, 14, 15, 17, 20, 25
+};
+static const uint16_t circle_x_start_15[15] = {
+    15, 14, 14, 14, 14, 13, 13, 12, 12, 11, 10, 9, 7, 5, 1
+};
+
+static const lv_opa_t circle_opa_16[29] = {
+    0, 0, 192, 144, 80, 0, 240, 144, 32, 240, 128, 0, 208, 16, 208, 32,
+    208, 16, 208, 0, 128, 240, 32, 144, 240, 0, 80, 144, 192
+};
+static const uint16_t circle_opa_start_16[17] = {
+    0, 1, 2, 3, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 22, 25,
+    29
+};
+static const uint16_t circle_x_start_16[16] = {
+    16, 16, 15, 15, 15, 14, 14, 13, 13, 12, 11, 10, 9, 7, 5, 2
+};
+
+static const lv_opa_t circle_opa_17[25] = {
+    0, 0, 192, 160, 96, 16, 160, 64, 160, 16, 240, 64, 96, 0, 96, 64,
+    240, 16, 160, 64, 160, 16, 96, 160, 192
+};
+static const uint16_t circle_opa_start_17[18] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 15, 17, 19,
+    21, 25
+};
+static const uint16_t circle_x_start_17[17] = {
+    17, 17, 16, 16, 16, 16, 15, 15, 14, 13, 13, 12, 11, 9, 8, 6,
+    2
+};
+
+static const lv_opa_t circle_opa_22[38] = {
+    0, 0, 0, 208, 192, 128, 64, 0, 240, 160, 64, 0, 192, 64, 0, 176,
+    16, 240, 64, 96, 144, 96, 64, 240, 16, 176, 0, 64, 192, 0, 64, 160,
+    240, 0, 64, 128, 192, 208
+};
+static const uint16_t circle_opa_start_22[23] = {
+    0, 1, 2, 4, 5, 6, 7, 9, 10, 11, 13, 14, 16, 18, 19, 20,
+    21, 22, 24, 26, 29, 33, 38
+};
+static const uint16_t circle_x_start_22[22] = {
+    22, 22, 21, 21, 21, 21, 20, 20, 20, 19, 19, 18, 17, 17, 16, 15,
+    14, 12, 11, 9, 6, 2
+};
+
+const _lv_draw_mask_radius_circle_dsc_t _lv_circle_tables[] = {
+    {NULL, (lv_opa_t *)circle_opa_2, (uint16_t *)circle_x_start_2, (uint16_t *)circle_opa_start_2, 1, 0, 2},
+    {NULL, (lv_opa_t *)circle_opa_10, (uint16_t *)circle_x_start_10, (uint16_t *)circle_opa_start_10, 1, 0, 10},
+    {NULL, (lv_opa_t *)circle_opa_11, (uint16_t *)circle_x_start_11, (uint16_t *)circle_opa_start_11, 1, 0, 11},
+    {NULL, (lv_opa_t *)circle_opa_12, (uint16_t *)circle_x_start_12, (uint16_t *)circle_opa_start_12, 1, 0, 12},
+    {NULL, (lv_opa_t *)circle_opa_13, (uint16_t *)circle_x_start_13, (uint16_t *)circle_opa_start_13, 1, 0, 13},
+    {NULL, (lv_opa_t *)circle_opa_14, (uint16_t *)circle_x_start_14, (uint16_t *)circle_opa_start_14, 1, 0, 14},
+    {NULL, (lv_opa_t *)circle_opa_15, (uint16_t *)circle_x_start_15, (uint16_t *)circle_opa_start_15, 1, 0, 15},
+    {NULL, (lv_opa_t *)circle_opa_16, (uint16_t *)circle_x_start_16, (uint16_t *)circle_opa_start_16, 1, 0, 16},
+    {NULL, (lv_opa_t *)circle_opa_17, (uint16_t *)circle_x_start_17, (uint16_t *)circle_opa_start_17, 1, 0, 17},
+    {NULL, (lv_opa_t *)circle_opa_22, (uint16_t *)circle_x_start_22, (uint16_t *)circle_opa_start_22, 1, 0, 22},
+};
+
+const uint16_t _lv_circle_tables_cnt = 10;
+
+#endif /*LV_USE_CIRCLE_TABLES*/
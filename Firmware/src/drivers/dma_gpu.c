@@ -0,0 +1,200 @@
+/**
+ * @file dma_gpu.c
+ *
+ * @brief Archivo con la implementación de la "GPU" por DMA del buffer de dibujo.
+ *
+ * Cada trabajo es una lista de @ref dma_gpu_block_t, una por fila del rectangulo, que el canal
+ * de control copia en los registros alias 1 del canal de datos, igual que el flujo del
+ * transporte por PIO del LCD. El bloque final dispara el canal de datos con @c count en 0 y
+ * levanta su bandera de interrupción, que marca el fin del trabajo sin habilitar la IRQ.
+ *
+ * @see dma_gpu.h
+ * @see pio_lcd_driver.c
+ */
+
+#include <string.h>
+#include "../../include/drivers/dma_gpu.h"
+
+/**
+ * @brief Canales, bloques y estadisticas de la GPU por DMA de un core.
+ */
+typedef struct
+{
+    uint data_ch;                                   /**< Canal que escribe los pixeles*/
+    uint ctrl_ch;                                   /**< Canal que carga los bloques en el canal de datos*/
+    uint32_t block_ctrl[2][2];                      /**< CTRL del canal de datos: [copia][palabras de 32 bits]*/
+    uint32_t color32;                               /**< Color del relleno en las dos mitades, leído por el DMA*/
+    bool active;                                    /**< Hay un trabajo que aún no se ha esperado*/
+    dma_gpu_block_t blocks[DMA_GPU_MAX_ROWS + 1];   /**< Una fila por bloque más el bloque final*/
+    dma_gpu_stats_t stats;                          /**< Estadisticas del core*/
+} dma_gpu_core_t;
+
+static dma_gpu_core_t gpu_cores[DMA_GPU_MAX_CORES];
+static uint8_t gpu_core_count;
+
+/**
+ * @brief Retorna el estado del core que llama, NULL si no tiene canales.
+ */
+static dma_gpu_core_t *gpu_get(void) {
+    uint core = get_core_num();
+
+    return core < gpu_core_count ? &gpu_cores[core] : NULL;
+}
+
+/**
+ * @brief Arma y arranca un trabajo con las primeras filas del rectangulo.
+ *
+ * Si las filas son contiguas en destino y origen todo el rectangulo va en un bloque, si no
+ * se hacen hasta @ref DMA_GPU_MAX_ROWS filas. Usa palabras de 32 bits cuando todas las filas
+ * quedan alineadas, dos pixeles por transferencia.
+ *
+ * @param gpu Estado del core, sin trabajo en curso.
+ * @param dest Primer pixel de destino.
+ * @param dest_stride Pixeles por fila del destino.
+ * @param src Primer pixel de origen, NULL para rellenar con @c gpu->color32.
+ * @param src_stride Pixeles por fila del origen.
+ * @param width Ancho del rectangulo.
+ * @param height Alto del rectangulo.
+ * @return Filas que hace el DMA, las demás quedan para la CPU.
+ */
+static uint16_t gpu_start(dma_gpu_core_t *gpu, uint16_t *dest, uint16_t dest_stride, const uint16_t *src,
+                          uint16_t src_stride, uint16_t width, uint16_t height) {
+    bool copy = src != NULL;
+    uint32_t row_px = width;
+    uint16_t rows = height;
+    uint16_t done;
+
+    if (width == dest_stride && (!copy || width == src_stride)) {
+        row_px = (uint32_t)width * height;
+        rows = 1;
+        done = height;
+    } else {
+        if (rows > DMA_GPU_MAX_ROWS) rows = DMA_GPU_MAX_ROWS;
+        done = rows;
+    }
+
+    bool word = !((uintptr_t)dest & 3) && !(row_px & 1) && !(dest_stride & 1);
+    if (copy) word = word && !((uintptr_t)src & 3) && !(src_stride & 1);
+    uint32_t ctrl = gpu->block_ctrl[copy][word];
+    uint32_t count = word ? row_px / 2 : row_px;
+
+    for (uint16_t row = 0; row < rows; row++) {
+        dma_gpu_block_t *blk = &gpu->blocks[row];
+        blk->ctrl = ctrl;
+        blk->read = copy ? (const void *)(src + (uint32_t)row * src_stride) : (const void *)&gpu->color32;
+        blk->write = dest + (uint32_t)row * dest_stride;
+        blk->count = count;
+    }
+    gpu->blocks[rows].ctrl = ctrl;
+    gpu->blocks[rows].read = NULL;
+    gpu->blocks[rows].write = NULL;
+    gpu->blocks[rows].count = 0;
+
+    dma_hw->intr = 1u << gpu->data_ch;
+    gpu->active = true;
+    gpu->stats.jobs++;
+    gpu->stats.px += row_px * rows;
+    dma_channel_set_read_addr(gpu->ctrl_ch, gpu->blocks, true);
+
+    return done;
+}
+
+void DMA_GPU_init(uint8_t cores) {
+    if (cores > DMA_GPU_MAX_CORES) cores = DMA_GPU_MAX_CORES;
+
+    for (uint8_t core = 0; core < cores; core++) {
+        dma_gpu_core_t *gpu = &gpu_cores[core];
+
+        gpu->data_ch = dma_claim_unused_channel(true);
+        gpu->ctrl_ch = dma_claim_unused_channel(true);
+
+        // Sin DREQ, a la velocidad del bus. Cada fila encadena al canal de control y en modo
+        // quiet solo el bloque final levanta la bandera de interrupción
+        for (uint8_t i = 0; i < 4; i++) {
+            dma_channel_config cfg = dma_channel_get_default_config(gpu->data_ch);
+            channel_config_set_transfer_data_size(&cfg, (i & 1) ? DMA_SIZE_32 : DMA_SIZE_16);
+            channel_config_set_read_increment(&cfg, i >= 2);
+            channel_config_set_write_increment(&cfg, true);
+            channel_config_set_chain_to(&cfg, gpu->ctrl_ch);
+            channel_config_set_irq_quiet(&cfg, true);
+            gpu->block_ctrl[i / 2][i & 1] = channel_config_get_ctrl_value(&cfg);
+        }
+
+        // El canal de control escribe 4 palabras en CTRL, READ, WRITE y TRANS_COUNT_TRIG
+        dma_channel_config cfg = dma_channel_get_default_config(gpu->ctrl_ch);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+        channel_config_set_read_increment(&cfg, true);
+        channel_config_set_write_increment(&cfg, true);
+        channel_config_set_ring(&cfg, true, 4);
+        dma_channel_configure(gpu->ctrl_ch, &cfg, &dma_hw->ch[gpu->data_ch].al1_ctrl, NULL, 4, false);
+    }
+    gpu_core_count = cores;
+}
+
+void DMA_GPU_Fill(uint16_t *dest, uint16_t dest_stride, uint16_t width, uint16_t height, uint16_t color) {
+    dma_gpu_core_t *gpu = gpu_get();
+    uint16_t done = 0;
+
+    if (gpu) {
+        DMA_GPU_Wait();
+        gpu->color32 = color | ((uint32_t)color << 16);
+        done = gpu_start(gpu, dest, dest_stride, NULL, 0, width, height);
+        gpu->stats.cpu_px += (uint32_t)(height - done) * width;
+    }
+
+    // Las filas que no caben en los bloques las rellena la CPU mientras el DMA hace las primeras
+    for (uint16_t row = done; row < height; row++) {
+        uint16_t *d = dest + (uint32_t)row * dest_stride;
+        for (uint16_t x = 0; x < width; x++) d[x] = color;
+    }
+}
+
+void DMA_GPU_Copy(uint16_t *dest, uint16_t dest_stride, const uint16_t *src, uint16_t src_stride,
+                  uint16_t width, uint16_t height) {
+    dma_gpu_core_t *gpu = gpu_get();
+    uint16_t done = 0;
+
+    if (gpu) {
+        DMA_GPU_Wait();
+        done = gpu_start(gpu, dest, dest_stride, src, src_stride, width, height);
+        gpu->stats.cpu_px += (uint32_t)(height - done) * width;
+    }
+
+    for (uint16_t row = done; row < height; row++) {
+        memcpy(dest + (uint32_t)row * dest_stride, src + (uint32_t)row * src_stride, width * sizeof(uint16_t));
+    }
+}
+
+bool DMA_GPU_Busy(void) {
+    dma_gpu_core_t *gpu = gpu_get();
+
+    return gpu && gpu->active && !(dma_hw->intr & (1u << gpu->data_ch));
+}
+
+void DMA_GPU_Wait(void) {
+    dma_gpu_core_t *gpu = gpu_get();
+    if (!gpu || !gpu->active) return;
+
+    uint32_t done = 1u << gpu->data_ch;
+    if (!(dma_hw->intr & done)) {
+        uint32_t start_us = time_us_32();
+        while (!(dma_hw->intr & done)) tight_loop_contents();
+        gpu->stats.waits++;
+        gpu->stats.wait_us += time_us_32() - start_us;
+    }
+    dma_hw->intr = done;
+    gpu->active = false;
+}
+
+void DMA_GPU_GetStats(dma_gpu_stats_t *stats, bool reset) {
+    memset(stats, 0, sizeof(*stats));
+    for (uint8_t core = 0; core < gpu_core_count; core++) {
+        dma_gpu_stats_t *s = &gpu_cores[core].stats;
+        stats->jobs += s->jobs;
+        stats->px += s->px;
+        stats->cpu_px += s->cpu_px;
+        stats->waits += s->waits;
+        stats->wait_us += s->wait_us;
+        if (reset) memset(s, 0, sizeof(*s));
+    }
+}
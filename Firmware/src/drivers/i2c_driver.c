@@ -19,8 +19,43 @@
 
 
 #include "stdio.h"
+#include "hardware/irq.h"
 #include "../../include/drivers/i2c_driver.h"
 
+/*! @brief Canales de DMA de las lecturas por DMA: comandos hacia el I2C y bytes desde el I2C*/
+static uint dma_i2c_cmd, dma_i2c_rx;
+/*! @brief Registro y comandos de lectura de una lectura por DMA, el último lleva el STOP*/
+static uint32_t dma_i2c_cmds[I2C_DMA_MAX_LEN + 1];
+/*! @brief Lectura por DMA en curso*/
+static volatile bool dma_i2c_busy;
+static i2c_inst_t *dma_i2c_port;
+static uint8_t *dma_i2c_data;
+static uint32_t dma_i2c_len;
+static i2c_dma_callback_t dma_i2c_done;
+
+/**
+ * @brief Bloquea las interrupciones de los GPIO mientras se usa el bus.
+ *
+ * La interrupción del MAX30102 lee su FIFO por este mismo bus, si entrara en medio de una
+ * transacción del bucle principal (la IMU) las dos se mezclarían. El flanco que llegue mientras
+ * tanto queda pendiente y la interrupción entra al liberar el bus.
+ *
+ * @return si las interrupciones estaban habilitadas, para i2c_bus_release().
+ */
+static inline bool i2c_bus_claim(void)
+{
+    bool enabled = irq_is_enabled(IO_IRQ_BANK0);
+    irq_set_enabled(IO_IRQ_BANK0, false);
+    // Una lectura por DMA termina en su propia interrupción
+    while (dma_i2c_busy) tight_loop_contents();
+    return enabled;
+}
+
+static inline void i2c_bus_release(bool enabled)
+{
+    if (enabled) irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
 
 /********************************************************************************************************************************************
  * 
@@ -31,22 +66,28 @@
 void i2c_write_byte (i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg, uint8_t value) 
 {
     uint8_t data[2] = {reg, value};
+    bool irq = i2c_bus_claim();
     i2c_write_blocking(i2c_port, addr, data, 2, false);
+    i2c_bus_release(irq);
 }
 
 void i2c_write_nbytes(i2c_inst_t *i2c_port, uint8_t addr, uint8_t *pData, uint32_t len)
 {
+    bool irq = i2c_bus_claim();
     i2c_write_blocking(i2c_port, addr, pData, len, false);
+    i2c_bus_release(irq);
 }
 
 uint8_t i2c_read_byte(i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg)
 {
     uint8_t buf;
+    bool irq = i2c_bus_claim();
 
     // Write the register to read
     i2c_write_blocking(i2c_port, addr, &reg, 1, true);
     // Read the register
     i2c_read_blocking(i2c_port, addr, &buf, 1, false);
+    i2c_bus_release(irq);
 
     // printf("Read byte: 0x%02X on register 0x%02X\n", buf, reg);
     return buf;
@@ -54,12 +95,112 @@ uint8_t i2c_read_byte(i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg)
 
 void i2c_read_nbytes(i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t len)
 {
+    bool irq = i2c_bus_claim();
     // Write the register to read
     i2c_write_blocking(i2c_port, addr, &reg, 1, true);
     // Read the register
     i2c_read_blocking(i2c_port, addr, pData, len, false);
+    i2c_bus_release(irq);
+}
+
+
+/********************************************************************************************************************************************
+ * 
+ * funciones para la lectura por DMA
+ * ******************************************************************************************************************************************
+*/
+
+static void i2c_dma_finish(bool ok)
+{
+    i2c_get_hw(dma_i2c_port)->intr_mask = 0;
+    dma_i2c_cmds[dma_i2c_len] &= ~I2C_IC_DATA_CMD_STOP_BITS;
+    dma_i2c_busy = false;
+    // El callback puede empezar otra lectura
+    dma_i2c_done(dma_i2c_data, dma_i2c_len, ok);
+}
+
+static void i2c_dma_irq(void)
+{
+    dma_channel_acknowledge_irq1(dma_i2c_rx);
+    if (dma_i2c_busy) i2c_dma_finish(true);
 }
 
+static void i2c_abort_irq(void)
+{
+    // El dispositivo no respondió: el I2C descarta los comandos y el DMA de recepción no termina
+    i2c_hw_t *hw = i2c_get_hw(dma_i2c_port);
+    if (!(hw->intr_stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS)) return;
+    dma_channel_set_irq1_enabled(dma_i2c_rx, false);
+    dma_channel_abort(dma_i2c_cmd);
+    dma_channel_abort(dma_i2c_rx);
+    dma_channel_acknowledge_irq1(dma_i2c_rx);
+    dma_channel_set_irq1_enabled(dma_i2c_rx, true);
+    // Al limpiar el abort el I2C vuelve a pedir comandos, los canales ya deben estar detenidos
+    (void)hw->clr_tx_abrt;
+    if (dma_i2c_busy) i2c_dma_finish(false);
+}
+
+/**
+ * @brief Reserva los canales de DMA de las lecturas por DMA y sus interrupciones.
+ */
+static void i2c_dma_init(i2c_inst_t *i2c_port)
+{
+    dma_i2c_port = i2c_port;
+    dma_i2c_cmd = dma_claim_unused_channel(true);
+    dma_i2c_rx = dma_claim_unused_channel(true);
+
+    // Los comandos no cambian entre lecturas, solo se mueve el STOP
+    dma_i2c_cmds[1] = I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_RESTART_BITS;
+    for (uint32_t i = 2; i <= I2C_DMA_MAX_LEN; i++) dma_i2c_cmds[i] = I2C_IC_DATA_CMD_CMD_BITS;
+
+    // DMA_IRQ_0 es del LCD
+    dma_channel_set_irq1_enabled(dma_i2c_rx, true);
+    irq_set_exclusive_handler(DMA_IRQ_1, i2c_dma_irq);
+    irq_set_enabled(DMA_IRQ_1, true);
+    // La máscara arranca con TX_EMPTY y otras habilitadas, solo se habilita el abort durante una lectura
+    i2c_get_hw(i2c_port)->intr_mask = 0;
+    irq_set_exclusive_handler(I2C1_IRQ, i2c_abort_irq);
+    irq_set_enabled(I2C1_IRQ, true);
+}
+
+bool i2c_dma_busy(void)
+{
+    return dma_i2c_busy;
+}
+
+bool i2c_read_nbytes_dma(i2c_inst_t *i2c_port, uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t len, i2c_dma_callback_t done)
+{
+    if (dma_i2c_busy || i2c_port != dma_i2c_port || len == 0 || len > I2C_DMA_MAX_LEN) return false;
+    dma_i2c_busy = true;
+    dma_i2c_data = pData;
+    dma_i2c_len = len;
+    dma_i2c_done = done;
+    dma_i2c_cmds[0] = reg;
+    dma_i2c_cmds[len] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+    i2c_hw_t *hw = i2c_get_hw(i2c_port);
+    // La dirección solo cambia con el I2C deshabilitado, como en el SDK
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+    // La interrupción de abort solo durante la lectura, las funciones bloqueantes leen el abort ellas mismas
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+    dma_channel_config cfg = dma_channel_get_default_config(dma_i2c_rx);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_dreq(&cfg, i2c_get_dreq(i2c_port, false));
+    dma_channel_configure(dma_i2c_rx, &cfg, pData, &hw->data_cmd, len, true);
+
+    cfg = dma_channel_get_default_config(dma_i2c_cmd);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, i2c_get_dreq(i2c_port, true));
+    dma_channel_configure(dma_i2c_cmd, &cfg, &hw->data_cmd, dma_i2c_cmds, len + 1, true);
+    return true;
+}
 
 
 /********************************************************************************************************************************************
@@ -111,6 +252,9 @@ void smartwatch_i2c_init(void)
     gpio_pull_up(I2C_SDA);
     gpio_pull_up(I2C_SCL);
 
+    // Lecturas por DMA de la FIFO del sensor de pulso
+    i2c_dma_init(i2c1);
+
     // Inicializar la IMU
     imu_pin_setup();
     //max_pin_setup();
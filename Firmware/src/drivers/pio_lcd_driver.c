@@ -0,0 +1,115 @@
+/**
+ * @file pio_lcd_driver.c
+ *
+ * @brief Archivo con la implementación del transporte del LCD por PIO.
+ *
+ * El canal @c dma_tx lleva los datos a la FIFO del PIO y al terminar cada bloque se encadena
+ * al canal de control, que copia el siguiente @ref pio_lcd_block_t en sus registros alias 1.
+ *
+ * @see pio_lcd_driver.h
+ * @see lcd_pio.pio
+ */
+
+#include "../../include/drivers/pio_lcd_driver.h"
+#include "lcd_pio.pio.h"
+
+static uint lcd_sm;
+static uint dma_ctrl;
+// Registro CTRL del canal de datos para transferencias de 8, 16 y 32 bits, sin y con incremento de lectura
+static uint32_t block_ctrl[2][3];
+
+static void config_pio(void) {
+    uint offset = pio_add_program(LCD_PIO_INST, &lcd_pio_program);
+    lcd_sm = pio_claim_unused_sm(LCD_PIO_INST, true);
+
+    pio_gpio_init(LCD_PIO_INST, LCD_DC_PIN);
+    pio_gpio_init(LCD_PIO_INST, LCD_SCK_PIN);
+    pio_gpio_init(LCD_PIO_INST, LCD_MOSI_PIN);
+    pio_sm_set_consecutive_pindirs(LCD_PIO_INST, lcd_sm, LCD_DC_PIN, 1, true);
+    pio_sm_set_consecutive_pindirs(LCD_PIO_INST, lcd_sm, LCD_SCK_PIN, 2, true);
+
+    pio_sm_config cfg = lcd_pio_program_get_default_config(offset);
+    sm_config_set_out_pins(&cfg, LCD_MOSI_PIN, 1);
+    sm_config_set_set_pins(&cfg, LCD_DC_PIN, 1);
+    sm_config_set_sideset_pins(&cfg, LCD_SCK_PIN);
+    // MSB primero y sin autopull, el programa descarta lo que sobra de cada palabra
+    sm_config_set_out_shift(&cfg, false, false, 32);
+    sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&cfg, LCD_PIO_CLKDIV);
+
+    pio_sm_init(LCD_PIO_INST, lcd_sm, offset, &cfg);
+    pio_sm_set_enabled(LCD_PIO_INST, lcd_sm, true);
+}
+
+static void config_pio_dma(void) {
+    static const enum dma_channel_transfer_size sizes[3] = {DMA_SIZE_8, DMA_SIZE_16, DMA_SIZE_32};
+
+    dma_tx = dma_claim_unused_channel(true);
+    dma_ctrl = dma_claim_unused_channel(true);
+
+    // Cada bloque termina encadenando al canal de control, en modo quiet solo el
+    // bloque final (count en 0) genera interrupción
+    for (uint8_t i = 0; i < 6; i++) {
+        dma_channel_config cfg = dma_channel_get_default_config(dma_tx);
+        channel_config_set_transfer_data_size(&cfg, sizes[i % 3]);
+        channel_config_set_read_increment(&cfg, i >= 3);
+        channel_config_set_write_increment(&cfg, false);
+        channel_config_set_dreq(&cfg, pio_get_dreq(LCD_PIO_INST, lcd_sm, true));
+        channel_config_set_chain_to(&cfg, dma_ctrl);
+        channel_config_set_irq_quiet(&cfg, true);
+        block_ctrl[i / 3][i % 3] = channel_config_get_ctrl_value(&cfg);
+    }
+
+    // El canal de control escribe 4 palabras en CTRL, READ, WRITE y TRANS_COUNT_TRIG
+    dma_channel_config cfg = dma_channel_get_default_config(dma_ctrl);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_ring(&cfg, true, 4);
+    dma_channel_configure(dma_ctrl, &cfg, &dma_hw->ch[dma_tx].al1_ctrl, NULL, 4, false);
+}
+
+void PIO_LCD_init(void) {
+    // Pines de control del display y brillo, iguales al transporte por SPI
+    config_display_pins();
+    config_pwm();
+
+    config_pio();
+    config_pio_dma();
+}
+
+void PIO_LCD_WaitIdle(void) {
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + lcd_sm);
+
+    // La maquina de estados se detiene esperando la siguiente cabecera
+    LCD_PIO_INST->fdebug = stall;
+    while (!(LCD_PIO_INST->fdebug & stall)) tight_loop_contents();
+}
+
+void PIO_LCD_Write(uint8_t dc, const uint8_t *pData, uint32_t Len) {
+    if (Len == 0) return;
+
+    pio_sm_put_blocking(LCD_PIO_INST, lcd_sm, PIO_LCD_HEADER(dc, 8, Len));
+    for (uint32_t i = 0; i < Len; i++) {
+        pio_sm_put_blocking(LCD_PIO_INST, lcd_sm, (uint32_t)pData[i] << 24);
+    }
+    PIO_LCD_WaitIdle();
+}
+
+void PIO_LCD_SetBlock(pio_lcd_block_t *blk, const void *data, uint32_t count, enum dma_channel_transfer_size size, bool incr) {
+    blk->ctrl = block_ctrl[incr][size];
+    blk->read = data;
+    blk->write = &LCD_PIO_INST->txf[lcd_sm];
+    blk->count = count;
+}
+
+void PIO_LCD_SetBlockEnd(pio_lcd_block_t *blk) {
+    blk->ctrl = block_ctrl[1][DMA_SIZE_32];
+    blk->read = NULL;
+    blk->write = NULL;
+    blk->count = 0;
+}
+
+void PIO_LCD_StartBlocks(const pio_lcd_block_t *blocks) {
+    dma_channel_set_read_addr(dma_ctrl, blocks, true);
+}
@@ -23,6 +23,7 @@
 dma_channel_config c;
 uint dma_tx;
 uint slice_num;
+static uint8_t spi_data_bits = 8;
 
 void config_display_pins(void) {
     // Configura los pines de control del display
@@ -70,7 +71,7 @@ void config_dma(void) {
     dma_tx = dma_claim_unused_channel(true);
     c = dma_channel_get_default_config(dma_tx);
 
-    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_transfer_data_size(&c, LCD_SPI_16BIT ? DMA_SIZE_16 : DMA_SIZE_8);
     channel_config_set_dreq(&c, spi_get_dreq(SPI_PORT, true));
 
 }
@@ -107,6 +108,21 @@ void SPI_Write_nByte(uint8_t pData[], uint32_t Len)
     spi_write_blocking(SPI_PORT, pData, Len);
 }
 
+void SPI_WaitIdle(void)
+{
+    while (spi_is_busy(SPI_PORT)) tight_loop_contents();
+}
+
+void SPI_SetDataBits(uint8_t bits)
+{
+    if (bits == spi_data_bits) return;
+
+    // No se puede cambiar el formato con datos aun en la FIFO
+    SPI_WaitIdle();
+    spi_set_format(SPI_PORT, bits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    spi_data_bits = bits;
+}
+
 void set_pwm(uint8_t level) {
     pwm_set_chan_level(slice_num, PWM_CHAN_B, level);
 }
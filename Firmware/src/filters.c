@@ -0,0 +1,161 @@
+/**
+ * @file filters.c
+ *
+ * @brief Implementación de los filtros en punto fijo.
+ *
+ * Las versiones de bloque copian el estado del filtro a variables locales, que el compilador
+ * mantiene en registros durante todo el bloque, y lo guardan al final.
+ *
+ * @see filters.h
+ */
+
+#ifndef SMARTWATCH_HOST
+#include "pico/stdlib.h"
+#endif
+#include <string.h>
+
+#include "../include/filters.h"
+
+/*! @brief Máscara de la posición en la historia del FIR*/
+#define FIR_MASK (FILTER_FIR_MAX_TAPS - 1)
+
+static inline int32_t sat16(int32_t x) {
+    return x > INT16_MAX ? INT16_MAX : x < INT16_MIN ? INT16_MIN : x;
+}
+
+void filter_ma_init(filter_ma_t *f, int32_t *buf, uint16_t len) {
+    memset(buf, 0, len * sizeof(int32_t));
+    f->buf = buf;
+    f->len = len;
+    f->pos = 0;
+    f->fill = 0;
+    f->sum = 0;
+}
+
+int32_t FILTER_FAST_FUNC(filter_ma)(filter_ma_t *f, int32_t x) {
+    int32_t y;
+    filter_ma_block(f, &x, &y, 1);
+    return y;
+}
+
+void FILTER_FAST_FUNC(filter_ma_block)(filter_ma_t *f, const int32_t *in, int32_t *out, uint16_t n) {
+    int32_t *buf = f->buf;
+    int32_t sum = f->sum;
+    uint16_t len = f->len;
+    uint16_t pos = f->pos;
+
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t x = in[i];
+        // La muestra que sale del promedio se resta y la nueva se suma
+        sum += x - buf[pos];
+        buf[pos] = x;
+        if (++pos == len) pos = 0;
+        if (f->fill < len && ++f->fill < len) out[i] = x;
+        else out[i] = sum / (int32_t)len;
+    }
+    f->sum = sum;
+    f->pos = pos;
+}
+
+void filter_dc_init(filter_dc_t *f, uint8_t shift) {
+    f->acc = 0;
+    f->shift = shift;
+    f->primed = false;
+}
+
+int32_t FILTER_FAST_FUNC(filter_dc)(filter_dc_t *f, int32_t x) {
+    int32_t y;
+    filter_dc_block(f, &x, &y, 1);
+    return y;
+}
+
+void FILTER_FAST_FUNC(filter_dc_block)(filter_dc_t *f, const int32_t *in, int32_t *out, uint16_t n) {
+    if (n == 0) return;
+    if (!f->primed) {
+        f->acc = in[0] * 256;
+        f->primed = true;
+    }
+
+    int32_t acc = f->acc;
+    uint8_t shift = f->shift;
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t x = in[i];
+        acc += (x * 256 - acc) >> shift;
+        out[i] = x - (acc >> 8);
+    }
+    f->acc = acc;
+}
+
+void filter_fir_init(filter_fir_t *f, const int16_t *coefs, uint8_t half) {
+    if (2 * half + 1 > FILTER_FIR_MAX_TAPS) half = (FILTER_FIR_MAX_TAPS - 1) / 2;
+    f->coefs = coefs;
+    f->half = half;
+    f->pos = 0;
+    memset(f->hist, 0, sizeof(f->hist));
+}
+
+int32_t FILTER_FAST_FUNC(filter_fir)(filter_fir_t *f, int32_t x) {
+    int32_t y;
+    filter_fir_block(f, &x, &y, 1);
+    return y;
+}
+
+void FILTER_FAST_FUNC(filter_fir_block)(filter_fir_t *f, const int32_t *in, int32_t *out, uint16_t n) {
+    const int16_t *c = f->coefs;
+    int16_t *hist = f->hist;
+    uint8_t half = f->half;
+    uint8_t pos = f->pos;
+
+    for (uint16_t i = 0; i < n; i++) {
+        pos = (pos + 1) & FIR_MASK;
+        hist[pos] = sat16(in[i]);
+
+        // Los taps simétricos comparten coeficiente: se suman las muestras y se multiplica una vez
+        int32_t z = c[half] * hist[(pos - half) & FIR_MASK];
+        for (uint8_t k = 0; k < half; k++) {
+            z += c[k] * (hist[(pos - k) & FIR_MASK] + hist[(pos - 2 * half + k) & FIR_MASK]);
+        }
+        out[i] = z >> 15;
+    }
+    f->pos = pos;
+}
+
+void filter_biquad_init(filter_biquad_t *f, const int16_t coefs[5]) {
+    memset(f, 0, sizeof(filter_biquad_t));
+    f->b0 = coefs[0];
+    f->b1 = coefs[1];
+    f->b2 = coefs[2];
+    f->a1 = coefs[3];
+    f->a2 = coefs[4];
+}
+
+int32_t FILTER_FAST_FUNC(filter_biquad)(filter_biquad_t *f, int32_t x) {
+    int32_t y;
+    filter_biquad_block(f, &x, &y, 1);
+    return y;
+}
+
+void FILTER_FAST_FUNC(filter_biquad_block)(filter_biquad_t *f, const int32_t *in, int32_t *out, uint16_t n) {
+    int32_t b0 = f->b0, b1 = f->b1, b2 = f->b2, a1 = f->a1, a2 = f->a2;
+    int32_t x1 = f->x1, x2 = f->x2, y1 = f->y1, y2 = f->y2;
+    int32_t err = f->err;
+
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t x = sat16(in[i]);
+        // El residuo del desplazamiento pasa a la siguiente muestra, sin él los polos cerca de 1
+        // de un pasabanda de baja frecuencia dejan un offset
+        int32_t acc = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2 + err;
+        int32_t y = sat16(acc >> 14);
+        err = acc & 0x3FFF;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        out[i] = y;
+    }
+    f->x1 = x1;
+    f->x2 = x2;
+    f->y1 = y1;
+    f->y2 = y2;
+    f->err = err;
+}
@@ -0,0 +1,995 @@
+/**
+ * @file font_subsets.c
+ *
+ * @brief Fuentes Montserrat recortadas a los caracteres de font_subsets.h.
+ *
+ * Generado por host/font_subsets_gen.c con el target font_subsets_update, no editar.
+ */
+
+#include "../include/font_subsets.h"
+
+#if FONT_SUBSETS
+
+/*-----------------
+ * montserrat_10_subset
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t montserrat_10_subset_bitmap[] = {
+    /* U+0020 */
+    /* U+002D */
+    0x5c, 0xc3,
+    /* U+0030 */
+    0x04, 0xdd, 0xb1, 0x01, 0xe2, 0x06, 0xb0, 0x69, 0x00, 0x0e, 0x17, 0x80, 0x00, 0xd2, 0x69, 0x00,
+    0x0e, 0x11, 0xe2, 0x06, 0xb0, 0x04, 0xdd, 0xb1, 0x00,
+    /* U+0031 */
+    0xbe, 0xa0, 0x5a, 0x05, 0xa0, 0x5a, 0x05, 0xa0, 0x5a, 0x05, 0xa0,
+    /* U+0032 */
+    0x4c, 0xdd, 0x50, 0x42, 0x01, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x0a, 0x80, 0x00, 0xa9, 0x00, 0x0b,
+    0x80, 0x00, 0x8f, 0xdd, 0xd5,
+    /* U+0033 */
+    0x8d, 0xde, 0xe0, 0x00, 0x0c, 0x40, 0x00, 0x98, 0x00, 0x00, 0xbd, 0x90, 0x00, 0x00, 0xd3, 0x51,
+    0x01, 0xe2, 0x6d, 0xdd, 0x60,
+    /* U+0034 */
+    0x00, 0x07, 0xa0, 0x00, 0x05, 0xc0, 0x00, 0x03, 0xd1, 0x31, 0x01, 0xd2, 0x0b, 0x30, 0x8d, 0xcc,
+    0xfd, 0x70, 0x00, 0x0b, 0x30, 0x00, 0x00, 0xb3, 0x00,
+    /* U+0035 */
+    0x0f, 0xdd, 0xd0, 0x1d, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x3e, 0xdc, 0x60, 0x00, 0x01, 0xd4, 0x31,
+    0x00, 0xc4, 0x5c, 0xdd, 0x80,
+    /* U+0036 */
+    0x02, 0xbd, 0xd4, 0x1e, 0x40, 0x00, 0x6a, 0x00, 0x00, 0x7a, 0xab, 0xa1, 0x6e, 0x10, 0x5c, 0x1d,
+    0x00, 0x3c, 0x04, 0xcc, 0xb2,
+    /* U+0037 */
+    0xbd, 0xdd, 0xe8, 0xb4, 0x00, 0xd3, 0x00, 0x04, 0xc0, 0x00, 0x0c, 0x40, 0x00, 0x3d, 0x00, 0x00,
+    0xa6, 0x00, 0x01, 0xe0, 0x00,
+    /* U+0038 */
+    0x07, 0xcc, 0xb2, 0x3d, 0x00, 0x6a, 0x2d, 0x00, 0x79, 0x0b, 0xec, 0xf2, 0x6a, 0x00, 0x4d, 0x79,
+    0x00, 0x3e, 0x09, 0xcb, 0xc4,
+    /* U+0039 */
+    0x1a, 0xcc, 0x60, 0x96, 0x00, 0xb3, 0x97, 0x00, 0xc9, 0x09, 0xbb, 0x8a, 0x00, 0x00, 0x88, 0x00,
+    0x02, 0xe2, 0x2d, 0xdc, 0x40,
+    /* U+003A */
+    0x6a, 0x01, 0x00, 0x02, 0x6a,
+    /* U+0053 */
+    0x08, 0xdc, 0xc3, 0x5b, 0x00, 0x11, 0x4d, 0x20, 0x00, 0x06, 0xde, 0x90, 0x00, 0x01, 0x9a, 0x33,
+    0x00, 0x5b, 0x3b, 0xcc, 0xb2,
+    /* U+0061 */
+    0x1b, 0xcd, 0x60, 0x01, 0x00, 0xe0, 0x1a, 0xaa, 0xf1, 0x78, 0x00, 0xe1, 0x2c, 0xaa, 0xe1,
+    /* U+0062 */
+    0x1e, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x1e, 0xac, 0xd6, 0x01, 0xf3, 0x01, 0xe2, 0x1e, 0x00,
+    0x0a, 0x51, 0xf4, 0x01, 0xe2, 0x1d, 0x9c, 0xd5, 0x00,
+    /* U+0063 */
+    0x07, 0xdd, 0xa0, 0x5c, 0x00, 0x40, 0x87, 0x00, 0x00, 0x5c, 0x00, 0x41, 0x07, 0xdd, 0xa0,
+    /* U+0065 */
+    0x08, 0xcc, 0x90, 0x5a, 0x00, 0x87, 0x8c, 0xaa, 0xa8, 0x5b, 0x00, 0x20, 0x07, 0xdc, 0xb1,
+    /* U+006C */
+    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
+    /* U+006D */
+    0x1e, 0xab, 0xc5, 0xbb, 0xc2, 0x1f, 0x20, 0x5f, 0x10, 0x69, 0x1e, 0x00, 0x2c, 0x00, 0x4b, 0x1e,
+    0x00, 0x2c, 0x00, 0x4b, 0x1e, 0x00, 0x2c, 0x00, 0x4b,
+    /* U+0070 */
+    0x1e, 0xab, 0xd6, 0x01, 0xf3, 0x01, 0xd2, 0x1e, 0x00, 0x0a, 0x51, 0xf4, 0x01, 0xe2, 0x1e, 0xac,
+    0xd5, 0x01, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    /* U+0073 */
+    0x2c, 0xcc, 0x48, 0x80, 0x00, 0x2a, 0xca, 0x21, 0x00, 0x6a, 0x6c, 0xcc, 0x30,
+    /* U+0074 */
+    0x0f, 0x00, 0x9f, 0xb6, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x10, 0x07, 0xd9,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t montserrat_10_subset_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 43, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 61, .box_w = 4, .box_h = 1, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27, .adv_w = 59, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 38, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 59, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 80, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 105, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 126, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 147, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 168, .adv_w = 103, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 189, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 210, .adv_w = 36, .box_w = 2, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 215, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 236, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 251, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 276, .adv_w = 91, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 291, .adv_w = 98, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 306, .adv_w = 45, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 313, .adv_w = 169, .box_w = 10, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 338, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 363, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 376, .adv_w = 66, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 0}
+};
+
+static const uint8_t montserrat_10_subset_ascii_ids[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 16, 17, 0, 18, 0, 0, 0, 0, 0, 0, 19, 20, 0, 0,
+    21, 0, 0, 22, 23
+};
+
+static const lv_font_fmt_txt_cmap_t montserrat_10_subset_cmaps[] = {
+    {.range_start = 32, .range_length = 85, .glyph_id_start = 0, .unicode_list = NULL, .glyph_id_ofs_list = montserrat_10_subset_ascii_ids, .list_length = 85, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL}
+};
+
+static const uint8_t montserrat_10_subset_kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 6, 7, 8, 9, 2, 10, 11, 12,
+    13, 14, 15, 16, 12, 13, 17, 18
+};
+static const uint8_t montserrat_10_subset_kern_right_class_mapping[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 2, 8, 9, 10, 11, 12, 13,
+    14, 15, 15, 14, 16, 16, 17, 18
+};
+static const int8_t montserrat_10_subset_kern_class_values[] = {
+    0, 1, -3, -2, -3, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -4, 0, -2, 0, 0, -8,
+    2, -1, 1, -1, 4, 0, 2, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -8, -3,
+    2, 0, -1, -10, -3, 0, -3, 0, -3, -1, -6, 0, -8, -4, -5, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, -2, 0, -1, 2, 0, -2, 0, -2, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, -1, 0, 0, 0, -4, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -4, -2, -4, 0, 0, -4,
+    0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -4, -1, -3, -3,
+    0, -2, -1, -1, 1, 0, 0, -1, -1, 0, 0, 1, 2, 0, -4, -2,
+    -3, 0, 0, -4, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, -1, -2, -2, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -3, -3, -1, 0, -5, -1, -4, -1, -2, 0, 0, 0, 0,
+    -3, 0, 0, -2
+};
+
+static const lv_font_fmt_txt_kern_classes_t montserrat_10_subset_kern_classes = {
+    .class_pair_values = montserrat_10_subset_kern_class_values,
+    .left_class_mapping = montserrat_10_subset_kern_left_class_mapping,
+    .right_class_mapping = montserrat_10_subset_kern_right_class_mapping,
+    .left_class_cnt = 18,
+    .right_class_cnt = 18,
+};
+
+static lv_font_fmt_txt_glyph_cache_t montserrat_10_subset_cache;
+
+static const lv_font_fmt_txt_dsc_t montserrat_10_subset_dsc = {
+    .glyph_bitmap = montserrat_10_subset_bitmap,
+    .glyph_dsc = montserrat_10_subset_glyph_dsc,
+    .cmaps = montserrat_10_subset_cmaps,
+    .kern_dsc = &montserrat_10_subset_kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &montserrat_10_subset_cache
+};
+
+const lv_font_t montserrat_10_subset = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 11,
+    .base_line = 2,
+    .subpx = 0,
+    .underline_position = 0,
+    .underline_thickness = 0,
+    .dsc = &montserrat_10_subset_dsc
+};
+
+/*-----------------
+ * montserrat_14_subset
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t montserrat_14_subset_bitmap[] = {
+    /* U+0025 */
+    0x08, 0xdd, 0x30, 0x00, 0xa7, 0x00, 0x4b, 0x02, 0xd0, 0x04, 0xc0, 0x00, 0x77, 0x00, 0xd0, 0x1d,
+    0x20, 0x00, 0x4b, 0x03, 0xd0, 0xa7, 0x00, 0x00, 0x07, 0xdc, 0x34, 0xc4, 0xcc, 0x30, 0x00, 0x00,
+    0x1d, 0x2d, 0x22, 0xd0, 0x00, 0x00, 0xa6, 0x3b, 0x00, 0xb3, 0x00, 0x05, 0xc0, 0x3a, 0x00, 0xa3,
+    0x00, 0x1d, 0x20, 0x0d, 0x00, 0xd0, 0x00, 0xa6, 0x00, 0x04, 0xcc, 0x40,
+    /* U+0030 */
+    0x00, 0x4c, 0xfe, 0x70, 0x00, 0x4f, 0xb6, 0x8f, 0x90, 0x0d, 0xb0, 0x00, 0x5f, 0x32, 0xf4, 0x00,
+    0x00, 0xe7, 0x4f, 0x20, 0x00, 0x0c, 0xa4, 0xf2, 0x00, 0x00, 0xca, 0x2f, 0x40, 0x00, 0x0e, 0x70,
+    0xdb, 0x00, 0x05, 0xf2, 0x04, 0xfb, 0x68, 0xf9, 0x00, 0x04, 0xcf, 0xe7, 0x00,
+    /* U+0031 */
+    0xef, 0xfb, 0x44, 0xcb, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab,
+    0x00, 0xab, 0x00, 0xab,
+    /* U+0032 */
+    0x07, 0xdf, 0xea, 0x10, 0x8e, 0x85, 0x7e, 0xc0, 0x01, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x06, 0xf0,
+    0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x1c, 0xc0, 0x00, 0x01, 0xdb, 0x00, 0x00,
+    0x1d, 0xe5, 0x44, 0x42, 0x7f, 0xff, 0xff, 0xf9,
+    /* U+0033 */
+    0x7f, 0xff, 0xff, 0xf0, 0x24, 0x44, 0x5f, 0x90, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x09, 0xe1, 0x00,
+    0x00, 0x3f, 0xd8, 0x10, 0x00, 0x04, 0x6d, 0xd0, 0x00, 0x00, 0x02, 0xf4, 0x10, 0x00, 0x02, 0xf4,
+    0xbd, 0x75, 0x7d, 0xd0, 0x19, 0xdf, 0xea, 0x10,
+    /* U+0034 */
+    0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x07, 0xe1, 0x00, 0x00, 0x00,
+    0x4f, 0x40, 0x10, 0x00, 0x02, 0xf6, 0x00, 0xf5, 0x00, 0x1d, 0xa0, 0x00, 0xf5, 0x00, 0x7f, 0xff,
+    0xff, 0xff, 0xf3, 0x13, 0x33, 0x33, 0xf7, 0x30, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00,
+    0xf5, 0x00,
+    /* U+0035 */
+    0x09, 0xff, 0xff, 0xf0, 0x0a, 0xb4, 0x44, 0x40, 0x0c, 0x80, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00,
+    0x0f, 0xff, 0xfc, 0x40, 0x03, 0x34, 0x5c, 0xf2, 0x00, 0x00, 0x00, 0xf7, 0x10, 0x00, 0x00, 0xf7,
+    0x8e, 0x85, 0x6c, 0xf1, 0x08, 0xdf, 0xfb, 0x30,
+    /* U+0036 */
+    0x00, 0x2a, 0xef, 0xd5, 0x00, 0x3f, 0xd6, 0x57, 0x40, 0x0c, 0xc0, 0x00, 0x00, 0x02, 0xf4, 0x00,
+    0x00, 0x00, 0x4f, 0x5b, 0xff, 0xa1, 0x04, 0xfe, 0x84, 0x5d, 0xd0, 0x3f, 0x80, 0x00, 0x3f, 0x30,
+    0xe8, 0x00, 0x03, 0xf2, 0x06, 0xf8, 0x45, 0xdc, 0x00, 0x05, 0xdf, 0xe9, 0x10,
+    /* U+0037 */
+    0x9f, 0xff, 0xff, 0xfd, 0x9d, 0x44, 0x44, 0xe9, 0x9c, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x0b, 0xb0,
+    0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0xad, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x08, 0xe0, 0x00,
+    0x00, 0x0e, 0x80, 0x00, 0x00, 0x6f, 0x10, 0x00,
+    /* U+0038 */
+    0x01, 0x9e, 0xfe, 0x91, 0x00, 0xbe, 0x63, 0x6e, 0xc0, 0x0f, 0x60, 0x00, 0x6f, 0x00, 0xcc, 0x20,
+    0x2b, 0xc0, 0x02, 0xef, 0xff, 0xe2, 0x00, 0xdc, 0x42, 0x4c, 0xd0, 0x5f, 0x20, 0x00, 0x1f, 0x55,
+    0xf2, 0x00, 0x02, 0xf5, 0x0e, 0xd5, 0x35, 0xde, 0x00, 0x1a, 0xef, 0xea, 0x10,
+    /* U+0039 */
+    0x03, 0xbf, 0xea, 0x20, 0x2f, 0xa4, 0x4b, 0xe1, 0x8e, 0x00, 0x00, 0xe9, 0x9d, 0x00, 0x00, 0xdd,
+    0x4f, 0x71, 0x29, 0xff, 0x07, 0xff, 0xfc, 0x9e, 0x00, 0x02, 0x10, 0xac, 0x00, 0x00, 0x02, 0xf6,
+    0x07, 0x65, 0x8f, 0xb0, 0x0a, 0xef, 0xd7, 0x00,
+    /* U+F240 */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0f, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x2c, 0xfa, 0xfc, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x27, 0xfa, 0xfc, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x1f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+F241 */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x22, 0x21, 0x00, 0x0f, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x0c, 0xfa, 0xfc, 0x5f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xff, 0xf8, 0x00, 0x07, 0xfa, 0xfc, 0x26, 0x66, 0x66, 0x66, 0x63, 0x00, 0x0f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+F242 */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x10, 0x00, 0x00, 0x0f, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xd0,
+    0x00, 0x00, 0x0c, 0xfa, 0xfc, 0x5f, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x01, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xd0, 0x00, 0x00, 0x07, 0xfa, 0xfc, 0x26, 0x66, 0x66, 0x50, 0x00, 0x00, 0x0f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+F243 */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0xfc, 0x5f, 0xff, 0x30, 0x00,
+    0x00, 0x00, 0x0c, 0xfa, 0xfc, 0x5f, 0xff, 0x30, 0x00, 0x00, 0x00, 0x01, 0xfa, 0xfc, 0x5f, 0xff,
+    0x30, 0x00, 0x00, 0x00, 0x07, 0xfa, 0xfc, 0x26, 0x66, 0x10, 0x00, 0x00, 0x00, 0x0f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+F244 */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0xfa, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfa, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xfa, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t montserrat_14_subset_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 189, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 60, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 105, .adv_w = 83, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 125, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 165, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 205, .adv_w = 150, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 255, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 295, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 340, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 380, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 425, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 465, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 555, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 735, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 825, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0}
+};
+
+static const uint8_t montserrat_14_subset_ascii_ids[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11
+};
+
+static const uint16_t montserrat_14_subset_unicode_list[] = {
+    0, 1, 2, 3, 4
+};
+
+static const lv_font_fmt_txt_cmap_t montserrat_14_subset_cmaps[] = {
+    {.range_start = 37, .range_length = 21, .glyph_id_start = 0, .unicode_list = NULL, .glyph_id_ofs_list = montserrat_14_subset_ascii_ids, .list_length = 21, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+    {.range_start = 62016, .range_length = 5, .glyph_id_start = 12, .unicode_list = montserrat_14_subset_unicode_list, .glyph_id_ofs_list = NULL, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY}
+};
+
+static const uint8_t montserrat_14_subset_kern_left_class_mapping[] = {
+    0, 1, 2, 0, 3, 4, 5, 6, 7, 8, 9, 2, 0, 0, 0, 0,
+    0
+};
+static const uint8_t montserrat_14_subset_kern_right_class_mapping[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 2, 8, 9, 10, 0, 0, 0, 0,
+    0
+};
+static const int8_t montserrat_14_subset_kern_class_values[] = {
+    -27, 0, -4, 2, 2, 7, 4, -4, 4, 0, 0, 0, -1, -1, -2, 0,
+    0, -2, 0, 0, 2, -1, 0, 0, 0, -4, 0, -1, 0, 0, -2, 0,
+    0, -1, -1, 0, -2, -3, 0, 0, -7, 0, -6, -1, -3, 0, -1, -11,
+    2, -2, -2, 0, 0, -1, -1, 0, -1, -3, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 1, -4, 2, 0, -2, -15, -4, 0, -4, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const lv_font_fmt_txt_kern_classes_t montserrat_14_subset_kern_classes = {
+    .class_pair_values = montserrat_14_subset_kern_class_values,
+    .left_class_mapping = montserrat_14_subset_kern_left_class_mapping,
+    .right_class_mapping = montserrat_14_subset_kern_right_class_mapping,
+    .left_class_cnt = 9,
+    .right_class_cnt = 10,
+};
+
+static lv_font_fmt_txt_glyph_cache_t montserrat_14_subset_cache;
+
+static const lv_font_fmt_txt_dsc_t montserrat_14_subset_dsc = {
+    .glyph_bitmap = montserrat_14_subset_bitmap,
+    .glyph_dsc = montserrat_14_subset_glyph_dsc,
+    .cmaps = montserrat_14_subset_cmaps,
+    .kern_dsc = &montserrat_14_subset_kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &montserrat_14_subset_cache
+};
+
+const lv_font_t montserrat_14_subset = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 16,
+    .base_line = 3,
+    .subpx = 0,
+    .underline_position = 0,
+    .underline_thickness = 0,
+    .dsc = &montserrat_14_subset_dsc
+};
+
+/*-----------------
+ * montserrat_18_subset
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t montserrat_18_subset_bitmap[] = {
+    /* U+0020 */
+    /* U+002F */
+    0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x03, 0xf5, 0x00, 0x00, 0x09, 0xf0,
+    0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xe9, 0x00,
+    0x00, 0x04, 0xf4, 0x00, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x0e, 0x90, 0x00, 0x00, 0x4f, 0x40, 0x00,
+    0x00, 0xae, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x0a, 0xe0, 0x00, 0x00,
+    0x0f, 0x90, 0x00, 0x00, 0x5f, 0x30, 0x00, 0x00,
+    /* U+0030 */
+    0x00, 0x04, 0xbe, 0xeb, 0x40, 0x00, 0x00, 0x6f, 0xfb, 0xbf, 0xf6, 0x00, 0x02, 0xfd, 0x10, 0x01,
+    0xdf, 0x20, 0x0a, 0xf3, 0x00, 0x00, 0x3f, 0xa0, 0x0e, 0xe0, 0x00, 0x00, 0x0e, 0xe0, 0x0f, 0xb0,
+    0x00, 0x00, 0x0b, 0xf0, 0x1f, 0xa0, 0x00, 0x00, 0x0a, 0xf1, 0x0f, 0xb0, 0x00, 0x00, 0x0b, 0xf0,
+    0x0e, 0xe0, 0x00, 0x00, 0x0e, 0xe0, 0x09, 0xf3, 0x00, 0x00, 0x3f, 0x90, 0x02, 0xfd, 0x10, 0x01,
+    0xdf, 0x20, 0x00, 0x6f, 0xfb, 0xbf, 0xf6, 0x00, 0x00, 0x04, 0xbe, 0xeb, 0x40, 0x00,
+    /* U+0031 */
+    0xdf, 0xff, 0xc8, 0xaa, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00,
+    0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f,
+    0xc0,
+    /* U+0032 */
+    0x01, 0x8d, 0xfe, 0xc5, 0x00, 0x4f, 0xfd, 0xac, 0xff, 0x70, 0x3c, 0x30, 0x00, 0x2f, 0xf0, 0x00,
+    0x00, 0x00, 0x0b, 0xf2, 0x00, 0x00, 0x00, 0x0c, 0xf1, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00,
+    0x02, 0xee, 0x20, 0x00, 0x00, 0x2e, 0xf3, 0x00, 0x00, 0x02, 0xef, 0x30, 0x00, 0x00, 0x2e, 0xf3,
+    0x00, 0x00, 0x02, 0xef, 0x30, 0x00, 0x00, 0x2e, 0xfc, 0xaa, 0xaa, 0xa7, 0x5f, 0xff, 0xff, 0xff,
+    0xfb,
+    /* U+0033 */
+    0x5f, 0xff, 0xff, 0xff, 0xf0, 0x3a, 0xaa, 0xaa, 0xcf, 0xc0, 0x00, 0x00, 0x01, 0xee, 0x10, 0x00,
+    0x00, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x9f, 0x60, 0x00, 0x00, 0x04, 0xfe, 0x61, 0x00, 0x00, 0x05,
+    0xdf, 0xff, 0x50, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0x00, 0x00, 0x00, 0x07, 0xf6, 0x00, 0x00, 0x00,
+    0x06, 0xf6, 0x69, 0x10, 0x00, 0x1d, 0xf2, 0x9f, 0xfc, 0xbc, 0xff, 0x80, 0x04, 0xae, 0xfe, 0xb5,
+    0x00,
+    /* U+0034 */
+    0x00, 0x00, 0x00, 0x4f, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xed, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf2,
+    0x00, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x00, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x2f,
+    0xc0, 0x03, 0xc5, 0x00, 0x00, 0xde, 0x10, 0x04, 0xf7, 0x00, 0x0b, 0xf4, 0x00, 0x04, 0xf7, 0x00,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x39, 0x99, 0x99, 0x9b, 0xfc, 0x98, 0x00, 0x00, 0x00, 0x05,
+    0xf7, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf7, 0x00,
+    /* U+0035 */
+    0x02, 0xff, 0xff, 0xff, 0xf0, 0x04, 0xfc, 0xaa, 0xaa, 0xa0, 0x05, 0xf5, 0x00, 0x00, 0x00, 0x07,
+    0xf3, 0x00, 0x00, 0x00, 0x09, 0xf1, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xc7, 0x00, 0x07, 0xaa,
+    0xab, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0b, 0xf6, 0x00, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x00,
+    0x03, 0xfa, 0x3c, 0x20, 0x00, 0x0b, 0xf6, 0x6f, 0xfd, 0xbb, 0xef, 0xb0, 0x03, 0x9d, 0xff, 0xc7,
+    0x00,
+    /* U+0036 */
+    0x00, 0x01, 0x8d, 0xfe, 0xc6, 0x00, 0x04, 0xef, 0xca, 0xad, 0x90, 0x01, 0xee, 0x40, 0x00, 0x00,
+    0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x2a, 0xef, 0xd7,
+    0x00, 0x1f, 0xdf, 0xd9, 0x9d, 0xfb, 0x01, 0xff, 0xa0, 0x00, 0x0a, 0xf5, 0x0f, 0xf2, 0x00, 0x00,
+    0x3f, 0x90, 0xbf, 0x20, 0x00, 0x03, 0xf8, 0x04, 0xfa, 0x00, 0x00, 0xaf, 0x40, 0x09, 0xfd, 0x99,
+    0xdf, 0xa0, 0x00, 0x05, 0xcf, 0xfc, 0x60, 0x00,
+    /* U+0037 */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfb, 0xaa, 0xaa, 0xaf, 0xe0, 0x7f, 0x40, 0x00, 0x05, 0xf8,
+    0x06, 0xf4, 0x00, 0x00, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x3f, 0xa0, 0x00, 0x00, 0x00, 0x0a, 0xf3,
+    0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x50, 0x00, 0x00, 0x00, 0x0e, 0xe0,
+    0x00, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x10, 0x00, 0x00, 0x00, 0x4f, 0x90,
+    0x00, 0x00, 0x00, 0x0b, 0xf2, 0x00, 0x00, 0x00,
+    /* U+0038 */
+    0x00, 0x2a, 0xef, 0xfc, 0x70, 0x00, 0x3f, 0xfb, 0x89, 0xdf, 0xb0, 0x0a, 0xf5, 0x00, 0x00, 0xbf,
+    0x30, 0xbf, 0x10, 0x00, 0x08, 0xf4, 0x04, 0xfc, 0x42, 0x26, 0xfd, 0x00, 0x06, 0xff, 0xff, 0xfe,
+    0x10, 0x05, 0xfe, 0x85, 0x6a, 0xfd, 0x10, 0xee, 0x10, 0x00, 0x07, 0xf8, 0x2f, 0xa0, 0x00, 0x00,
+    0x1f, 0xb2, 0xfb, 0x00, 0x00, 0x02, 0xfb, 0x0d, 0xf4, 0x00, 0x00, 0xaf, 0x70, 0x3f, 0xfb, 0x89,
+    0xdf, 0xc0, 0x00, 0x29, 0xdf, 0xfc, 0x60, 0x00,
+    /* U+0039 */
+    0x00, 0x6c, 0xff, 0xc6, 0x00, 0x00, 0xaf, 0xd9, 0x8c, 0xfa, 0x00, 0x3f, 0xb0, 0x00, 0x07, 0xf6,
+    0x07, 0xf5, 0x00, 0x00, 0x0f, 0xd0, 0x6f, 0x60, 0x00, 0x02, 0xff, 0x11, 0xff, 0x51, 0x04, 0xdf,
+    0xf2, 0x04, 0xef, 0xff, 0xfb, 0x9f, 0x30, 0x00, 0x57, 0x73, 0x0a, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0x00, 0x8e, 0xba, 0xcf,
+    0xf5, 0x00, 0x05, 0xbe, 0xfd, 0x92, 0x00, 0x00,
+    /* U+0041 */
+    0x00, 0x00, 0x00, 0x8f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xf6, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x0b, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x4f, 0x60, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x02, 0xf8,
+    0x00, 0x06, 0xf5, 0x00, 0x00, 0x00, 0x9f, 0x10, 0x00, 0x0e, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x00, 0x07, 0xf8, 0x88, 0x88, 0x88, 0xfa, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+    0x0b, 0xf1, 0x00, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x4f, 0x80, 0x0c, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0xee, 0x00,
+    /* U+0044 */
+    0x1f, 0xff, 0xff, 0xfd, 0xa4, 0x00, 0x01, 0xfe, 0xaa, 0xaa, 0xcf, 0xfa, 0x00, 0x1f, 0xb0, 0x00,
+    0x00, 0x2b, 0xfa, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x3f,
+    0xb1, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xee, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x0d, 0xf1, 0xfb, 0x00,
+    0x00, 0x00, 0x00, 0xee, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x3f, 0xb1, 0xfb, 0x00, 0x00, 0x00, 0x0c,
+    0xf4, 0x1f, 0xb0, 0x00, 0x00, 0x2b, 0xfa, 0x01, 0xfe, 0xaa, 0xaa, 0xcf, 0xfa, 0x00, 0x1f, 0xff,
+    0xff, 0xfd, 0xa4, 0x00, 0x00,
+    /* U+0045 */
+    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xfe, 0xaa, 0xaa, 0xaa, 0x70, 0x1f, 0xb0, 0x00, 0x00, 0x00,
+    0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x99, 0x99, 0x99,
+    0x00, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00,
+    0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xaa, 0xaa,
+    0xaa, 0xa0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00,
+    /* U+0046 */
+    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xea, 0xaa, 0xaa, 0xa7, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f,
+    0xb0, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0xff,
+    0xff, 0xff, 0xf0, 0x1f, 0xe9, 0x99, 0x99, 0x90, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00,
+    0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00,
+    0x00,
+    /* U+0048 */
+    0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00,
+    0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xea,
+    0xaa, 0xaa, 0xaa, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb,
+    0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00,
+    0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb,
+    /* U+0049 */
+    0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f,
+    0xb1, 0xfb, 0x1f, 0xb0,
+    /* U+004D */
+    0x1f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x41, 0xff, 0x30, 0x00, 0x00, 0x00, 0x1f, 0xf4, 0x1f,
+    0xfc, 0x00, 0x00, 0x00, 0x09, 0xff, 0x41, 0xff, 0xf5, 0x00, 0x00, 0x02, 0xfe, 0xf4, 0x1f, 0xad,
+    0xe0, 0x00, 0x00, 0xbe, 0x8f, 0x41, 0xfa, 0x4f, 0x80, 0x00, 0x4f, 0x67, 0xf4, 0x1f, 0xa0, 0xaf,
+    0x20, 0x0d, 0xd0, 0x7f, 0x41, 0xfa, 0x02, 0xfa, 0x07, 0xf4, 0x07, 0xf4, 0x1f, 0xa0, 0x08, 0xf5,
+    0xea, 0x00, 0x7f, 0x41, 0xfa, 0x00, 0x0e, 0xff, 0x20, 0x06, 0xf4, 0x1f, 0xa0, 0x00, 0x5f, 0x80,
+    0x00, 0x6f, 0x41, 0xfa, 0x00, 0x00, 0x60, 0x00, 0x06, 0xf4, 0x1f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x6f, 0x40,
+    /* U+004E */
+    0x1f, 0xb0, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xf8, 0x00, 0x00, 0x01, 0xfb, 0x1f, 0xff, 0x50, 0x00,
+    0x01, 0xfb, 0x1f, 0xdf, 0xf2, 0x00, 0x01, 0xfb, 0x1f, 0xb6, 0xfd, 0x00, 0x01, 0xfb, 0x1f, 0xb0,
+    0x9f, 0xa0, 0x01, 0xfb, 0x1f, 0xb0, 0x0c, 0xf6, 0x01, 0xfb, 0x1f, 0xb0, 0x01, 0xef, 0x31, 0xfb,
+    0x1f, 0xb0, 0x00, 0x4f, 0xe2, 0xfb, 0x1f, 0xb0, 0x00, 0x07, 0xfd, 0xfb, 0x1f, 0xb0, 0x00, 0x00,
+    0xbf, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x1d, 0xfb, 0x1f, 0xb0, 0x00, 0x00, 0x02, 0xfb,
+    /* U+004F */
+    0x00, 0x00, 0x4a, 0xdf, 0xeb, 0x50, 0x00, 0x00, 0x00, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x00, 0x00,
+    0xbf, 0xb2, 0x00, 0x01, 0xaf, 0xd0, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x0c, 0xf1,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0x1f, 0xa0, 0x00,
+    0x00, 0x00, 0x00, 0x9f, 0x30, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0x0c, 0xf1, 0x00, 0x00,
+    0x00, 0x00, 0xfe, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0xbf, 0xb2, 0x00, 0x01,
+    0xaf, 0xd0, 0x00, 0x00, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x4a, 0xef, 0xeb, 0x50,
+    0x00, 0x00,
+    /* U+0052 */
+    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x00, 0x1f, 0xea, 0xaa, 0xbe, 0xfd, 0x10, 0x1f, 0xb0, 0x00, 0x00,
+    0x9f, 0x90, 0x1f, 0xb0, 0x00, 0x00, 0x0e, 0xf0, 0x1f, 0xb0, 0x00, 0x00, 0x0c, 0xf0, 0x1f, 0xb0,
+    0x00, 0x00, 0x0e, 0xe0, 0x1f, 0xb0, 0x00, 0x00, 0x9f, 0x90, 0x1f, 0xd9, 0x99, 0xae, 0xfd, 0x10,
+    0x1f, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x1f, 0xb0, 0x00, 0x1f, 0xd0, 0x00, 0x1f, 0xb0, 0x00, 0x06,
+    0xf9, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0xbf, 0x40, 0x1f, 0xb0, 0x00, 0x00, 0x1e, 0xe0,
+    /* U+0053 */
+    0x00, 0x29, 0xdf, 0xfd, 0x81, 0x00, 0x3f, 0xfc, 0x9a, 0xdf, 0xc0, 0x0b, 0xf4, 0x00, 0x00, 0x23,
+    0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfa, 0x61, 0x00,
+    0x00, 0x00, 0x3b, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x00, 0x48, 0xef, 0xb0, 0x00, 0x00, 0x00, 0x00,
+    0xbf, 0x40, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x0b, 0x50, 0x00, 0x00, 0xcf, 0x31, 0xdf, 0xeb, 0x9a,
+    0xef, 0x90, 0x00, 0x6b, 0xef, 0xeb, 0x50, 0x00,
+    /* U+0054 */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x89, 0xaa, 0xad, 0xfb, 0xaa, 0xa5, 0x00, 0x00, 0x9f, 0x20, 0x00,
+    0x00, 0x00, 0x09, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x09, 0xf2, 0x00,
+    0x00, 0x00, 0x00, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x09, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x20,
+    0x00, 0x00, 0x00, 0x09, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x09, 0xf2,
+    0x00, 0x00, 0x00, 0x00, 0x9f, 0x20, 0x00, 0x00,
+    /* U+0055 */
+    0x3f, 0x90, 0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00,
+    0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90,
+    0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00, 0x05, 0xf7, 0x3f, 0x90, 0x00, 0x00, 0x05, 0xf6,
+    0x2f, 0xb0, 0x00, 0x00, 0x07, 0xf5, 0x0e, 0xf0, 0x00, 0x00, 0x0b, 0xf2, 0x08, 0xfa, 0x00, 0x00,
+    0x7f, 0xb0, 0x00, 0xcf, 0xfb, 0xbe, 0xfe, 0x20, 0x00, 0x07, 0xcf, 0xfd, 0x81, 0x00,
+    /* U+0057 */
+    0x4f, 0x90, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0x02, 0xf8, 0x0e, 0xe0, 0x00, 0x00, 0x2f, 0xf8,
+    0x00, 0x00, 0x08, 0xf3, 0x09, 0xf3, 0x00, 0x00, 0x7f, 0xfd, 0x00, 0x00, 0x0d, 0xd0, 0x04, 0xf8,
+    0x00, 0x00, 0xcd, 0x8f, 0x20, 0x00, 0x2f, 0x80, 0x00, 0xfe, 0x00, 0x02, 0xf8, 0x3f, 0x80, 0x00,
+    0x7f, 0x30, 0x00, 0xaf, 0x30, 0x07, 0xf3, 0x0e, 0xd0, 0x00, 0xde, 0x00, 0x00, 0x5f, 0x80, 0x0c,
+    0xd0, 0x08, 0xf2, 0x02, 0xf9, 0x00, 0x00, 0x0f, 0xd0, 0x2f, 0x80, 0x03, 0xf7, 0x07, 0xf4, 0x00,
+    0x00, 0x0a, 0xf2, 0x7f, 0x30, 0x00, 0xed, 0x0c, 0xe0, 0x00, 0x00, 0x05, 0xf7, 0xdd, 0x00, 0x00,
+    0x9f, 0x4f, 0x90, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0x00, 0x00, 0x3f, 0xdf, 0x40, 0x00, 0x00, 0x00,
+    0xbf, 0xf3, 0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00, 0x09, 0xfa,
+    0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t montserrat_18_subset_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 72, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 150, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 183, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 248, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 313, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 391, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 456, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 528, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 600, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 672, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 744, .adv_w = 211, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 842, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 927, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 999, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1064, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1142, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1162, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1260, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1338, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1436, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1514, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1586, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1658, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1736, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0}
+};
+
+static const uint8_t montserrat_18_subset_ascii_ids[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 0, 0,
+    0, 13, 0, 0, 14, 15, 16, 0, 17, 18, 0, 0, 0, 19, 20, 21,
+    0, 0, 22, 23, 24, 25, 0, 26
+};
+
+static const lv_font_fmt_txt_cmap_t montserrat_18_subset_cmaps[] = {
+    {.range_start = 32, .range_length = 56, .glyph_id_start = 0, .unicode_list = NULL, .glyph_id_ofs_list = montserrat_18_subset_ascii_ids, .list_length = 56, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL}
+};
+
+static const uint8_t montserrat_18_subset_kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 6, 7, 8, 9, 2, 10, 11, 12,
+    13, 14, 14, 14, 14, 11, 15, 16, 17, 18, 19
+};
+static const uint8_t montserrat_18_subset_kern_right_class_mapping[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 2, 8, 9, 10, 11, 12, 12,
+    12, 12, 12, 12, 12, 13, 12, 14, 15, 16, 17
+};
+static const int8_t montserrat_18_subset_kern_class_values[] = {
+    -20, -6, 9, 0, 0, -19, 0, 3, -7, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -1, -1, -3, 0, 0, -2, 0, 0, -2, 0, 0, 0, -6,
+    0, -7, 3, -1, 0, 0, 0, -5, 0, -1, 0, 0, 1, 0, 0, 0,
+    -2, 0, -3, 0, 0, 0, -1, -1, 0, -3, -3, 0, 0, 1, 0, 0,
+    0, -2, 0, -3, 8, 0, -7, -1, -3, 0, -1, -14, 3, -2, 0, 0,
+    3, -2, -15, 0, -15, 0, 0, 0, -1, -1, 0, -1, -4, 0, 0, 0,
+    0, 0, 0, -3, 0, -2, 3, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    2, 0, 0, 0, -3, 0, -3, -12, -6, 3, 0, -2, -19, -5, 0, -5,
+    0, -18, 0, -5, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -3, 0, -5, 9, -2, -12, 0, 3, -4, 0,
+    -14, -1, -4, 4, 0, -3, 0, -10, -4, -11, -6, 0, -3, -3, -3, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, -3, 0, -6, 0, -4, 0, -2, -3,
+    -9, -2, -2, -2, -1, 0, 0, -1, 0, 0, 0, -3, -12, -4, 4, 0,
+    0, -14, -5, 3, -5, 2, -9, 0, -2, -1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, -2, -6, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, -3, 0, -2, 3, 0, -3, 0, -3, 0, 0, 0, 0, -3, 0, 0,
+    -6, -6, 12, 5, 3, -25, -2, 6, -3, 0, -10, 0, -3, -3, 3, -4,
+    -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -4,
+    0, 0, -12, -7, 9, 0, 1, -21, -2, 3, -5, -2, -11, -4, -6, -4,
+    -2, 0, 0
+};
+
+static const lv_font_fmt_txt_kern_classes_t montserrat_18_subset_kern_classes = {
+    .class_pair_values = montserrat_18_subset_kern_class_values,
+    .left_class_mapping = montserrat_18_subset_kern_left_class_mapping,
+    .right_class_mapping = montserrat_18_subset_kern_right_class_mapping,
+    .left_class_cnt = 19,
+    .right_class_cnt = 17,
+};
+
+static lv_font_fmt_txt_glyph_cache_t montserrat_18_subset_cache;
+
+static const lv_font_fmt_txt_dsc_t montserrat_18_subset_dsc = {
+    .glyph_bitmap = montserrat_18_subset_bitmap,
+    .glyph_dsc = montserrat_18_subset_glyph_dsc,
+    .cmaps = montserrat_18_subset_cmaps,
+    .kern_dsc = &montserrat_18_subset_kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &montserrat_18_subset_cache
+};
+
+const lv_font_t montserrat_18_subset = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 21,
+    .base_line = 4,
+    .subpx = 0,
+    .underline_position = 0,
+    .underline_thickness = 0,
+    .dsc = &montserrat_18_subset_dsc
+};
+
+/*-----------------
+ * montserrat_48_subset
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t montserrat_48_subset_bitmap[] = {
+    /* U+0030 */
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x8b, 0xef, 0xfe, 0xc8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xfb, 0x75, 0x57,
+    0xbf, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfb, 0x10, 0x00, 0x00, 0x01, 0xbf,
+    0xff, 0xff, 0x80, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff,
+    0xf3, 0x00, 0x00, 0xbf, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xfb, 0x00,
+    0x02, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x20, 0x08, 0xff,
+    0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x80, 0x0d, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xfb, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf1, 0x5f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5f, 0xff, 0xf7, 0x9f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0xff, 0xf9, 0xaf, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xfa,
+    0xaf, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfb, 0xaf, 0xff,
+    0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfb, 0xaf, 0xff, 0xf2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xfa, 0x9f, 0xff, 0xf3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf9, 0x7f, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5f, 0xff, 0xf7, 0x5f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8f, 0xff, 0xf5, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+    0xff, 0xf1, 0x0d, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xd0,
+    0x08, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x90, 0x02, 0xff,
+    0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x20, 0x00, 0xbf, 0xff, 0xfa,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xfb, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfb, 0x10, 0x00, 0x00,
+    0x01, 0xbf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xfb, 0x76, 0x67, 0xbf, 0xff,
+    0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x8c, 0xef, 0xfe, 0xc8, 0x30, 0x00, 0x00, 0x00, 0x00,
+    /* U+0031 */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x23, 0x33, 0x33, 0x34, 0xff, 0xff,
+    0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00,
+    0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff,
+    0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00,
+    0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f,
+    0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb,
+    /* U+0032 */
+    0x00, 0x00, 0x00, 0x03, 0x7b, 0xde, 0xff, 0xed, 0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x06, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xfa, 0x76, 0x55, 0x7a, 0xff, 0xff, 0xff, 0xf2,
+    0x00, 0x1c, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xbf,
+    0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff,
+    0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
+    0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9f, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff,
+    0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff,
+    0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xf5, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x01, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    /* U+0033 */
+    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0xff, 0xff, 0xe1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f,
+    0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xd1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xef, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff,
+    0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xfd, 0xa7, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x8e, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8f, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
+    0xff, 0xf2, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x06,
+    0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0x90, 0x0e, 0xff, 0xfe, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xef, 0xff, 0xff, 0x10, 0x8f, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x56,
+    0x7a, 0xef, 0xff, 0xff, 0xf7, 0x00, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,
+    0x00, 0x01, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x9c, 0xef, 0xff, 0xec, 0x96, 0x10, 0x00, 0x00, 0x00,
+    /* U+0034 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xef, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfe,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0x40,
+    0x00, 0x00, 0x03, 0xbb, 0xbb, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x80, 0x00,
+    0x00, 0x00, 0x5f, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xb0, 0x00, 0x00,
+    0x00, 0x05, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00,
+    0x00, 0x5f, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x01, 0xef, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7f,
+    0xff, 0xf4, 0x22, 0x22, 0x21, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00, 0x00, 0x00,
+    /* U+0035 */
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x8f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xb0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xa0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xdc, 0x96, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x60, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x00,
+    0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x02, 0x33,
+    0x33, 0x33, 0x33, 0x45, 0x79, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff,
+    0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+    0xff, 0xfa, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf6, 0x00,
+    0xdf, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf1, 0x06, 0xff, 0xff, 0xc5,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xff, 0xff, 0x90, 0x0e, 0xff, 0xff, 0xff, 0xfc, 0x87, 0x65,
+    0x68, 0xcf, 0xff, 0xff, 0xfe, 0x10, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe3, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x00,
+    0x00, 0x00, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x7b, 0xde, 0xff, 0xfd, 0xb8, 0x40, 0x00, 0x00, 0x00,
+    /* U+0036 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xac, 0xef, 0xfe, 0xdb, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xb7, 0x53, 0x33, 0x57,
+    0xbf, 0xf4, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+    0x00, 0x00, 0x0d, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xf3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xf8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xff, 0xff, 0x50, 0x00, 0x05, 0xad, 0xef, 0xfe, 0xb8, 0x30, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf3,
+    0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x09, 0xff, 0xff, 0x22, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xaf, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x00, 0x0b, 0xff, 0xff, 0xef, 0xff, 0xf9, 0x41, 0x00, 0x03, 0x8e, 0xff,
+    0xff, 0xf8, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xf2,
+    0x09, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x06, 0xff, 0xff, 0xfa, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5f, 0xff, 0xf4, 0x0b, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
+    0xff, 0x30, 0x5f, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf1, 0x00,
+    0xef, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfd, 0x00, 0x07, 0xff, 0xff,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x70, 0x00, 0x0d, 0xff, 0xff, 0xc2, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xfa, 0x41, 0x00, 0x03,
+    0x8e, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0xce, 0xff, 0xfd, 0xa6, 0x10, 0x00, 0x00, 0x00,
+    /* U+0037 */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xdf, 0xff,
+    0xf4, 0x9f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xc0, 0x9f, 0xff,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0x50, 0x9f, 0xff, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x9f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8f, 0xff, 0xf7, 0x00, 0x9f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff,
+    0xf1, 0x00, 0x25, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xbf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff,
+    0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xef, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+0038 */
+    0x00, 0x00, 0x00, 0x01, 0x69, 0xce, 0xff, 0xfe, 0xc9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xf8, 0x41, 0x00, 0x01, 0x49, 0xff,
+    0xff, 0xff, 0x50, 0x00, 0x0f, 0xff, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xff, 0xfe,
+    0x00, 0x05, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xf4, 0x00, 0x9f,
+    0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x70, 0x0a, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf9, 0x00, 0xaf, 0xff, 0xf1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6f, 0xff, 0xf6, 0x00, 0x3f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff,
+    0xff, 0x10, 0x00, 0xbf, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0x90, 0x00,
+    0x01, 0xef, 0xff, 0xff, 0x95, 0x20, 0x00, 0x25, 0xaf, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x01, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xbc, 0xdf, 0xff, 0xff,
+    0xff, 0xc1, 0x00, 0x01, 0xef, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x04, 0xaf, 0xff, 0xff, 0xd1,
+    0x00, 0xbf, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0x90, 0x3f, 0xff,
+    0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x29, 0xff, 0xff, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf7, 0xcf, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xff, 0xfc, 0xdf, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+    0xff, 0xcc, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfa, 0x8f,
+    0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf1, 0x0b, 0xff, 0xff, 0xf6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfa, 0x00, 0x2e, 0xff, 0xff, 0xfd, 0x73, 0x00, 0x00, 0x14,
+    0x8e, 0xff, 0xff, 0xfe, 0x10, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,
+    0x00, 0x00, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0xac, 0xef, 0xff, 0xec, 0xa6, 0x20, 0x00, 0x00, 0x00,
+    /* U+0039 */
+    0x00, 0x00, 0x00, 0x03, 0x8c, 0xef, 0xff, 0xdb, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xb5, 0x10, 0x00, 0x15, 0xbf, 0xff,
+    0xff, 0xb0, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0x70,
+    0x00, 0x0e, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0x20, 0x04, 0xff,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xf9, 0x00, 0x8f, 0xff, 0xf3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xe0, 0x09, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x50, 0xaf, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xaf, 0xff, 0xf9, 0x09, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff,
+    0xff, 0xc0, 0x6f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01,
+    0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xef, 0xff, 0xff, 0xf1, 0x0a, 0xff, 0xff,
+    0xe4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xfb, 0x52,
+    0x00, 0x01, 0x5b, 0xff, 0xff, 0xef, 0xff, 0xf3, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb8, 0xff, 0xff, 0x40, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x8f, 0xff, 0xf4, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x09, 0xff, 0xff,
+    0x30, 0x00, 0x00, 0x01, 0x6a, 0xdf, 0xff, 0xec, 0x84, 0x00, 0x00, 0xaf, 0xff, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4f, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x70, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcf, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0xbf, 0xfa, 0x74, 0x33, 0x45, 0x9d, 0xff,
+    0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x69, 0xce, 0xff, 0xfe, 0xb9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+003A */
+    0x04, 0xcf, 0xc3, 0x03, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xf9, 0x8f, 0xff,
+    0xff, 0x61, 0xef, 0xff, 0xc0, 0x00, 0x79, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x97, 0x00, 0x1d, 0xff, 0xfc, 0x08, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xff,
+    0x9a, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x10, 0x4c, 0xfc, 0x30,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t montserrat_48_subset_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 512, .box_w = 28, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 476, .adv_w = 284, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 697, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1139, .adv_w = 439, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1581, .adv_w = 514, .box_w = 31, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2108, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2550, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3009, .adv_w = 459, .box_w = 26, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3451, .adv_w = 495, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3910, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4369, .adv_w = 174, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = 0}
+};
+
+static const lv_font_fmt_txt_cmap_t montserrat_48_subset_cmaps[] = {
+    {.range_start = 48, .range_length = 11, .glyph_id_start = 1, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}
+};
+
+static const uint8_t montserrat_48_subset_kern_left_class_mapping[] = {
+    0, 1, 0, 2, 3, 4, 5, 6, 7, 8, 1, 9
+};
+static const uint8_t montserrat_48_subset_kern_right_class_mapping[] = {
+    0, 1, 2, 3, 4, 5, 6, 1, 7, 8, 9, 10
+};
+static const int8_t montserrat_48_subset_kern_class_values[] = {
+    0, -2, -2, -8, 0, 0, -5, 0, 0, 0, -2, 0, 0, 0, -15, 0,
+    -2, 0, 0, 0, 0, 0, -4, -4, 0, -8, -9, 0, 0, 0, 0, -19,
+    -2, -9, 0, -2, -36, 8, -5, 5, 0, 0, -4, -4, 0, -4, -10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, -15, 8, 0, -6,
+    -50, -14, 0, -14, 0, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0
+};
+
+static const lv_font_fmt_txt_kern_classes_t montserrat_48_subset_kern_classes = {
+    .class_pair_values = montserrat_48_subset_kern_class_values,
+    .left_class_mapping = montserrat_48_subset_kern_left_class_mapping,
+    .right_class_mapping = montserrat_48_subset_kern_right_class_mapping,
+    .left_class_cnt = 9,
+    .right_class_cnt = 10,
+};
+
+static lv_font_fmt_txt_glyph_cache_t montserrat_48_subset_cache;
+
+static const lv_font_fmt_txt_dsc_t montserrat_48_subset_dsc = {
+    .glyph_bitmap = montserrat_48_subset_bitmap,
+    .glyph_dsc = montserrat_48_subset_glyph_dsc,
+    .cmaps = montserrat_48_subset_cmaps,
+    .kern_dsc = &montserrat_48_subset_kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &montserrat_48_subset_cache
+};
+
+const lv_font_t montserrat_48_subset = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 52,
+    .base_line = 9,
+    .subpx = 0,
+    .underline_position = 0,
+    .underline_thickness = 0,
+    .dsc = &montserrat_48_subset_dsc
+};
+
+#endif /*FONT_SUBSETS*/
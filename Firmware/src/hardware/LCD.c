@@ -19,11 +19,67 @@
  */
 
 #include "stdio.h"
+#include "hardware/irq.h"
 #include "../../include/hardware/LCD.h"
 #include "../../include/drivers/spi_driver.h"
 
 lcd_t LCD;
 
+static lcd_segment_t lcd_queue[LCD_QUEUE_LEN];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+static volatile bool queue_busy;
+static uint8_t queue_dc;
+static lcd_done_cb_t queue_done_cb;
+#if LCD_PIO
+// Cada segmento ocupa hasta dos bloques (cabecera y pixeles), más el bloque final
+static pio_lcd_block_t queue_blocks[2 * LCD_QUEUE_LEN + 1];
+#endif
+
+/**
+ * @brief Ventana abierta por el último RAMWR de la cola.
+ */
+static struct {
+    bool open;
+    uint16_t x1;
+    uint16_t x2;
+    uint16_t next_y;
+} lcd_window;
+
+/**
+ * @brief Columnas visibles de cada fila de la pantalla redonda, x1 > x2 si la fila no es visible.
+ */
+static struct {
+    bool enabled;
+    uint16_t x1[LCD_HEIGHT];
+    uint16_t x2[LCD_HEIGHT];
+} lcd_round;
+
+/**
+ * @brief Area que se está enviando recortada al circulo.
+ */
+static struct {
+    const uint16_t *pixels;
+    uint16_t x1;
+    uint16_t x2;
+    uint16_t y1;
+    uint16_t y2;
+    uint16_t y;
+    lcd_done_cb_t done_cb;
+} round_job;
+
+/**
+ * @brief Rectangulo de una imagen que se está enviando fila por fila.
+ */
+static struct {
+    const uint16_t *row;
+    uint16_t stride;
+    uint16_t w;
+    uint16_t y;
+    uint16_t y2;
+    lcd_done_cb_t done_cb;
+} blit_job;
+
 /**
  * @brief envia un comando al puerto spi1
  * 
@@ -31,11 +87,33 @@ lcd_t LCD;
  */
 static void LCD_SendCommand (uint8_t Reg) {
 
+    // Cualquier comando termina el RAMWR abierto por la cola
+    lcd_window.open = false;
+#if LCD_PIO
+    PIO_LCD_Write(0, &Reg, 1);
+#else
+    SPI_SetDataBits(8);
     gpio_put(LCD_DC_PIN, 0);
 
     SPI_WriteByte(Reg);
+#endif
 
+}
 
+/**
+ * @brief envia una cadena de datos al LCD por el transporte seleccionado
+ * 
+ * @param pData Datos a enviar
+ * @param Len Número de bytes
+ */
+static void LCD_SendData_nByte (uint8_t *pData, uint32_t Len) {
+#if LCD_PIO
+    PIO_LCD_Write(1, pData, Len);
+#else
+    SPI_SetDataBits(8);
+    gpio_put(LCD_DC_PIN, 1);
+    SPI_Write_nByte(pData, Len);
+#endif
 }
 
 /**
@@ -44,8 +122,7 @@ static void LCD_SendCommand (uint8_t Reg) {
  * @param Data Dato a enviar
  */
 static void LCD_SendData_8bit (uint8_t Data) {
-    gpio_put(LCD_DC_PIN, 1);
-    SPI_WriteByte(Data);
+    LCD_SendData_nByte(&Data, 1);
 }
 
 /**
@@ -54,9 +131,8 @@ static void LCD_SendData_8bit (uint8_t Data) {
  * @param Data Dato a enviar
  */
 static void LCD_SendData_16bit (uint16_t Data) {
-    gpio_put(LCD_DC_PIN, 1);
-    SPI_WriteByte(Data >> 8);
-    SPI_WriteByte(Data);
+    uint8_t bytes[2] = {Data >> 8, Data};
+    LCD_SendData_nByte(bytes, 2);
 }
 
 
@@ -378,61 +454,382 @@ void LCD_1IN28_SetWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint1
     LCD_SendData_8bit(Yend);
 
     LCD_SendCommand(0x2C);
-    gpio_put(LCD_DC_PIN, 1);
+}
+
+/**
+ * @brief Espera a que la cola del LCD termine de enviarse.
+ */
+static void LCD_QueueWait (void) {
+    while (LCD_QueueBusy()) tight_loop_contents();
 }
 
 void LCD_Clear(uint16_t color) {
 
-    uint16_t j;
-    uint16_t image[LCD_WIDTH* LCD_HEIGHT];
+    // Relleno por DMA desde una sola palabra, sin la imagen de 115 KB en el stack
+    LCD_QueueWait();
+    LCD_FillRect(0, 0, LCD.WIDTH - 1, LCD.HEIGHT - 1, color, NULL);
+    LCD_QueueWait();
 
-    color = ((color << 8)& 0xFF00) | (color >> 8);
+}   
 
-    for (j = 0; j < LCD_WIDTH* LCD_HEIGHT; j++) {
-        image[j] = color;
+void LCD_Display (uint16_t *image)
+{
+    LCD_QueueWait();
+    LCD_BlitRect(0, 0, LCD.WIDTH - 1, LCD.HEIGHT - 1, image, LCD.WIDTH, NULL);
+    LCD_QueueWait();
+
+}
+
+void LCD_1IN28_DisplayWindows (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t *Image) {
+
+    if (Xend <= Xstart || Yend <= Ystart) return;
+
+    LCD_QueueWait();
+    LCD_BlitRect(Xstart, Ystart, Xend - 1, Yend - 1, &Image[Ystart * LCD_WIDTH + Xstart], LCD_WIDTH, NULL);
+    LCD_QueueWait();
+
+}
+
+
+/**
+ * @addtogroup Cola de comandos asincrona
+ *
+ * @{
+ */
+
+/**
+ * @brief Agrega un segmento al final de la cola.
+ */
+static lcd_segment_t *LCD_QueuePush (uint8_t dc, uint8_t bits) {
+    lcd_segment_t *seg = &lcd_queue[queue_tail];
+
+    queue_tail = (queue_tail + 1) % LCD_QUEUE_LEN;
+    seg->data = NULL;
+    seg->len = 0;
+    seg->fill = false;
+    seg->dc = dc;
+    seg->bits = bits;
+    return seg;
+}
+
+#if LCD_PIO
+/**
+ * @brief Envia todos los segmentos de la cola en un solo flujo de DMA.
+ *
+ * Se llama al iniciar la cola y desde la interrupción del DMA. Cada segmento se convierte
+ * en bloques de control: su cabecera con el nivel de DC y, para los pixeles, el bloque de
+ * datos. El canal de control los encadena sin intervención de la CPU.
+ */
+static void LCD_QueueRun (void) {
+    pio_lcd_block_t *blk = queue_blocks;
+
+    while (queue_head != queue_tail) {
+        lcd_segment_t *seg = &lcd_queue[queue_head];
+        queue_head = (queue_head + 1) % LCD_QUEUE_LEN;
+
+        seg->words[0] = PIO_LCD_HEADER(seg->dc, seg->bits, seg->len);
+        if (seg->data == NULL) {
+            // Cada byte corto va en su propia palabra, el PIO envia solo los 8 bits altos
+            for (uint8_t i = 0; i < seg->len; i++) {
+                seg->words[1 + i] = (uint32_t)seg->bytes[i] << 24;
+            }
+            PIO_LCD_SetBlock(blk++, seg->words, 1 + seg->len, DMA_SIZE_32, true);
+            continue;
+        }
+
+        PIO_LCD_SetBlock(blk++, seg->words, 1, DMA_SIZE_32, true);
+        PIO_LCD_SetBlock(blk++, seg->data, seg->len, seg->bits == 16 ? DMA_SIZE_16 : DMA_SIZE_8, !seg->fill);
     }
 
-    LCD_1IN28_SetWindows(0, 0, LCD_WIDTH, LCD_HEIGHT);
-    gpio_put(LCD_DC_PIN, 1);
+    if (blk != queue_blocks) {
+        PIO_LCD_SetBlockEnd(blk);
+        PIO_LCD_StartBlocks(queue_blocks);
+        return; // La interrupción del bloque final termina la cola
+    }
 
-    for (j = 0; j < LCD_HEIGHT; j++) {
-        SPI_Write_nByte((uint8_t *)&image[j * LCD_WIDTH], LCD_WIDTH* 2);
+    queue_busy = false;
+    if (queue_done_cb) queue_done_cb();
+}
+#else
+/**
+ * @brief Envia los segmentos de la cola hasta encontrar uno que necesite DMA.
+ *
+ * Se llama al iniciar la cola y desde la interrupción del DMA. El pin DC y el tamaño
+ * de trama solo se cambian con el SPI vacío, los comandos y parametros cortos caben
+ * en la FIFO de 8 posiciones y no necesitan DMA.
+ */
+static void LCD_QueueRun (void) {
+    while (queue_head != queue_tail) {
+        lcd_segment_t *seg = &lcd_queue[queue_head];
+        queue_head = (queue_head + 1) % LCD_QUEUE_LEN;
+
+        if (seg->dc != queue_dc) {
+            SPI_WaitIdle();
+            gpio_put(LCD_DC_PIN, seg->dc);
+            queue_dc = seg->dc;
+        }
+        SPI_SetDataBits(seg->bits);
+
+        if (seg->data == NULL) {
+            for (uint8_t i = 0; i < seg->len; i++) {
+                while (!spi_is_writable(SPI_PORT)) tight_loop_contents();
+                spi_get_hw(SPI_PORT)->dr = seg->bytes[i];
+            }
+            continue;
+        }
+
+        channel_config_set_transfer_data_size(&c, seg->bits == 16 ? DMA_SIZE_16 : DMA_SIZE_8);
+        // Los rellenos leen siempre el mismo color
+        channel_config_set_read_increment(&c, !seg->fill);
+        dma_channel_configure(
+            dma_tx,
+            &c,
+            (volatile void *)&spi_get_hw(SPI_PORT)->dr,
+            seg->data,
+            seg->len,
+            true);
+        return; // La interrupción del DMA continua con la cola
     }
 
-}   
+    queue_busy = false;
+    if (queue_done_cb) queue_done_cb();
+}
+#endif
 
-void LCD_Display (uint16_t *image)
-{
-    uint16_t j;
-    LCD_1IN28_SetWindows(0, 0, LCD_WIDTH, LCD_HEIGHT);
-    gpio_put(LCD_DC_PIN, 1);
+static void LCD_DmaHandler (void) {
+    if (dma_channel_get_irq0_status(dma_tx)) {
+        dma_channel_acknowledge_irq0(dma_tx);
+        LCD_QueueRun();
+    }
+}
+
+void LCD_QueueCommand (uint8_t cmd, const uint8_t *params, uint8_t len) {
+    lcd_segment_t *seg = LCD_QueuePush(0, 8);
+    seg->bytes[0] = cmd;
+    seg->len = 1;
+
+    if (len) {
+        seg = LCD_QueuePush(1, 8);
+        for (uint8_t i = 0; i < len && i < sizeof(seg->bytes); i++) {
+            seg->bytes[i] = params[i];
+        }
+        seg->len = len;
+    }
+    lcd_window.open = false;
+}
 
-    for (j = 0; j < LCD_HEIGHT; j++) {
-        SPI_Write_nByte((uint8_t *)&image[j * LCD_WIDTH], LCD_WIDTH* 2);
+void LCD_QueueWindow (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend) {
+#if LCD_QUEUE_COALESCE
+    // Misma columna y justo debajo de lo último enviado: el RAMWR sigue abierto
+    if (lcd_window.open && lcd_window.x1 == Xstart && lcd_window.x2 == Xend && lcd_window.next_y == Ystart) {
+        lcd_window.next_y = Yend + 1;
+        return;
     }
+#endif
 
+    uint8_t caset[4] = {Xstart >> 8, Xstart, Xend >> 8, Xend};
+    // La ventana se abre hasta el final de la pantalla para poder continuarla
+    uint8_t raset[4] = {Ystart >> 8, Ystart, (LCD.HEIGHT - 1) >> 8, LCD.HEIGHT - 1};
+
+    LCD_QueueCommand(0x2A, caset, 4);
+    LCD_QueueCommand(0x2B, raset, 4);
+    LCD_QueueCommand(0x2C, NULL, 0);
+
+    lcd_window.open = true;
+    lcd_window.x1 = Xstart;
+    lcd_window.x2 = Xend;
+    lcd_window.next_y = Yend + 1;
 }
 
-void LCD_1IN28_DisplayWindows (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t *Image) {
+void LCD_QueuePixels (const uint16_t *pixels, uint32_t count) {
+    lcd_segment_t *seg = LCD_QueuePush(1, LCD_PIXEL_BITS);
+    seg->data = pixels;
+    seg->len = count * LCD_DMA_XFERS_PER_PIXEL;
+}
 
-    uint32_t Addr = 0;
-    uint16_t j;
+void LCD_QueueFill (uint16_t color, uint32_t count) {
+    // Siempre en tramas de 16 bits, en 8 bits el DMA no puede alternar los dos bytes
+    lcd_segment_t *seg = LCD_QueuePush(1, 16);
+    seg->color = color;
+    seg->data = &seg->color;
+    seg->fill = true;
+    seg->len = count;
+}
 
-    LCD_1IN28_SetWindows(Xstart, Ystart, Xend, Yend);
-    gpio_put(LCD_DC_PIN, 1);
+void LCD_QueueStart (lcd_done_cb_t done_cb) {
+    queue_done_cb = done_cb;
+    queue_busy = true;
+    // El DC pudo cambiar por fuera de la cola
+    queue_dc = 0xFF;
+    LCD_QueueRun();
+}
+
+bool LCD_QueueBusy (void) {
+    return queue_busy;
+}
+
+/**
+ * @brief Segmentos libres en la cola.
+ */
+static uint8_t LCD_QueueFree (void) {
+    return LCD_QUEUE_LEN - 1 - (queue_tail + LCD_QUEUE_LEN - queue_head) % LCD_QUEUE_LEN;
+}
+
+void LCD_SetRoundClip (bool enable, uint16_t hor_res, uint16_t ver_res) {
+    // Distancias en medios pixeles desde el centro, d es el diametro
+    int32_t d = hor_res < ver_res ? hor_res : ver_res;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        int32_t dy = 2 * y + 1 - ver_res;
+        int32_t rest = d * d - dy * dy;
+
+        lcd_round.x1[y] = 1;
+        lcd_round.x2[y] = 0;
+        if (y >= ver_res || rest < 0) continue;
+
+        int32_t s = 0;
+        while ((s + 1) * (s + 1) <= rest) s++;
+
+        lcd_round.x1[y] = (hor_res - s) / 2;
+        lcd_round.x2[y] = (hor_res - 1 + s) / 2;
+    }
+    lcd_round.enabled = enable;
+}
+
+/**
+ * @brief Columnas a enviar de una fila del area recortada al circulo.
+ *
+ * @return false si la fila no tiene pixeles visibles.
+ */
+static bool LCD_RoundRow (uint16_t y, uint16_t *xs, uint16_t *xe) {
+    uint16_t x1 = lcd_round.x1[y] > round_job.x1 ? lcd_round.x1[y] : round_job.x1;
+    uint16_t x2 = lcd_round.x2[y] < round_job.x2 ? lcd_round.x2[y] : round_job.x2;
+
+    if (x1 > x2) return false;
+
+    // Recortar solo si ahorra más de lo que cuesta abrir otra ventana
+    if ((round_job.x2 - round_job.x1) - (x2 - x1) < LCD_ROUND_MIN_SAVE) {
+        x1 = round_job.x1;
+        x2 = round_job.x2;
+    }
+    *xs = x1;
+    *xe = x2;
+    return true;
+}
 
-    for (j = Ystart; j < Yend; j++) {
-        Addr = j * LCD_WIDTH + Xstart;
-        SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend - Xstart) * 2);
+/**
+ * @brief Encola las siguientes filas del area recortada, se llama de nuevo al vaciarse la cola.
+ */
+static void LCD_RoundStep (void) {
+    uint16_t w = round_job.x2 - round_job.x1 + 1;
+
+    // Cada ventana ocupa 6 segmentos: CASET, RASET y RAMWR con sus parametros y los pixeles
+    while (round_job.y <= round_job.y2 && LCD_QueueFree() >= 6) {
+        uint16_t y = round_job.y;
+        uint16_t xs, xe;
+        const uint16_t *row = round_job.pixels + (uint32_t)(y - round_job.y1) * w;
+
+        if (!LCD_RoundRow(y, &xs, &xe)) {
+            round_job.y++;
+            continue;
+        }
+
+        // Las filas completas seguidas se envian en un solo bloque
+        uint16_t last = y;
+        uint16_t nxs, nxe;
+        while (xe - xs + 1 == w && last < round_job.y2 &&
+               LCD_RoundRow(last + 1, &nxs, &nxe) && nxe - nxs + 1 == w) {
+            last++;
+        }
+
+        LCD_QueueWindow(xs, y, xe, last);
+        LCD_QueuePixels(row + (xs - round_job.x1), (uint32_t)(xe - xs + 1) * (last - y + 1));
+        round_job.y = last + 1;
     }
 
+    LCD_QueueStart(round_job.y > round_job.y2 ? round_job.done_cb : LCD_RoundStep);
 }
 
+void LCD_FillRect (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t color, lcd_done_cb_t done_cb) {
+    LCD_QueueWindow(Xstart, Ystart, Xend, Yend);
+    LCD_QueueFill(color, (uint32_t)(Xend - Xstart + 1) * (Yend - Ystart + 1));
+    LCD_QueueStart(done_cb);
+}
+
+/**
+ * @brief Encola las siguientes filas del rectangulo, se llama de nuevo al vaciarse la cola.
+ */
+static void LCD_BlitStep (void) {
+    // Las filas siguen el RAMWR abierto por la ventana
+    while (blit_job.y <= blit_job.y2 && LCD_QueueFree() >= 1) {
+        LCD_QueuePixels(blit_job.row, blit_job.w);
+        blit_job.row += blit_job.stride;
+        blit_job.y++;
+    }
+
+    LCD_QueueStart(blit_job.y > blit_job.y2 ? blit_job.done_cb : LCD_BlitStep);
+}
+
+void LCD_BlitRect (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, const uint16_t *image, uint16_t stride, lcd_done_cb_t done_cb) {
+    uint16_t w = Xend - Xstart + 1;
+
+    LCD_QueueWindow(Xstart, Ystart, Xend, Yend);
+
+    if (stride == w) {
+        LCD_QueuePixels(image, (uint32_t)w * (Yend - Ystart + 1));
+        LCD_QueueStart(done_cb);
+        return;
+    }
+
+    blit_job.row = image;
+    blit_job.stride = stride;
+    blit_job.w = w;
+    blit_job.y = Ystart;
+    blit_job.y2 = Yend;
+    blit_job.done_cb = done_cb;
+    LCD_BlitStep();
+}
+
+uint32_t LCD_DrawArea (uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, const uint16_t *pixels, lcd_done_cb_t done_cb) {
+    uint32_t sent = (uint32_t)(Xend - Xstart + 1) * (Yend - Ystart + 1);
+
+    if (!lcd_round.enabled) {
+        LCD_QueueWindow(Xstart, Ystart, Xend, Yend);
+        LCD_QueuePixels(pixels, sent);
+        LCD_QueueStart(done_cb);
+        return sent;
+    }
+
+    round_job.pixels = pixels;
+    round_job.x1 = Xstart;
+    round_job.x2 = Xend;
+    round_job.y1 = Ystart;
+    round_job.y2 = Yend;
+    round_job.y = Ystart;
+    round_job.done_cb = done_cb;
+
+    sent = 0;
+    for (uint16_t y = Ystart; y <= Yend; y++) {
+        uint16_t xs, xe;
+        if (LCD_RoundRow(y, &xs, &xe)) sent += xe - xs + 1;
+    }
+
+    LCD_RoundStep();
+    return sent;
+}
+
+/**
+ * @}
+ */
 
 void LCD_init (uint8_t scan_dir) {
     // Reseteo por medio del pin
 
+#if LCD_PIO
+    PIO_LCD_init();
+#else
     SPI_init();
+#endif
 
     LCD_reset();
 
@@ -445,6 +842,11 @@ void LCD_init (uint8_t scan_dir) {
 
     LCD_InitReg();
 
+    // Interrupción del DMA que avanza la cola de comandos
+    dma_channel_set_irq0_enabled(dma_tx, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, LCD_DmaHandler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
     printf("LCD Init success\n");
 } 
 
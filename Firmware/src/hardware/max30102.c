@@ -22,7 +22,13 @@
 #include <string.h> 
 
 sense_struct_t FIFO;
-static bool read_ir;
+static volatile bool read_ir;
+//FIFO_DATA bytes of the last read, a full FIFO at most
+static uint8_t fifo_data[32 * 2 * 3];
+//Time of the first sample in fifo_data
+static uint32_t fifo_time_ms;
+//Reads started again because INT stayed low
+static uint8_t fifo_retries;
 
 static inline void max_write_reg(uint8_t reg, uint8_t value){
     i2c_write_byte(I2C_PORT,MAX_ADDR,reg,value);
@@ -51,7 +57,7 @@ void pulse_SPO2_config(){
 
 void pulse_FIFO_config(){
     FIFO_config_t config;
-    config.BITS.FIFO_AFULL=0; //number of bits till irq, prob not use it
+    config.BITS.FIFO_AFULL=MAX_FIFO_AFULL; //muestras libres cuando se activa A_FULL
     config.BITS.FIFO_ROLLOVER=1;
     config.BITS.SAMPLE_AVG=MAX_SA_8SAMPLE; //Gotta check that
     max_write_reg(FIFO_CONFIG_REG,config.WORD);
@@ -80,9 +86,16 @@ void pulse_enableSlots() {
     max_write_reg(MLED_MODE_CTRL1_REG,config);
 }
 
-void answer_maxIRQ(){
-    //printf("irq noticed \n");
-    read_ir=true;
+uint16_t pulse_checkFIFO(void);
+static void pulse_unpackFIFO(uint8_t *data, uint32_t len, bool ok);
+
+void answer_maxIRQ(uint gpio, uint32_t events){
+    // La FIFO llegó a MAX_FIFO_AFULL: se lee por DMA y el bucle principal solo procesa las muestras.
+    // Si ya hay una lectura en curso, al terminar revisa el pin y vuelve a leer
+    if(!i2c_dma_busy()){
+        fifo_retries=0;
+        pulse_checkFIFO();
+    }
 }
 
 void pulse_enableIRQ(){
@@ -94,8 +107,8 @@ void pulse_enableIRQ(){
     //configurar la interrupción
     gpio_set_irq_enabled_with_callback(MAX_INT, GPIO_IRQ_EDGE_FALL, true, &answer_maxIRQ);
 
-    //Hacer el enable en el MAX
-    max_write_reg(IRQ_EN1_REG,1<<6);
+    //Hacer el enable en el MAX, A_FULL_EN
+    max_write_reg(IRQ_EN1_REG,1<<7);
     //clear any possible interrupt
     uint8_t reg_INTR1 = max_read_reg(IRQ_STATUS1_REG); 
 
@@ -132,9 +145,12 @@ void max_init() {
     pulse_enableSlots();
     //Clear FIFO yay
     read_ir=false;
+    FIFO.head=0;
+    FIFO.tail=0;
+    FIFO.overruns=0;
+    pulse_resetFifo();
     pulse_enableIRQ();
 
-    pulse_resetFifo();
     if(max_read_reg(FIFO_RD_PTR_REG)==max_read_reg(FIFO_WR_PTR_REG)){
         printf("FIFO cleared, config done. \n");
     }
@@ -142,81 +158,78 @@ void max_init() {
 
 }
 
-//Polls the sensor for new data
-//Call regularly
-//If new data is available, it updates the head and tail in the main struct
-//Returns number of new samples obtained
-uint16_t pulse_checkFIFO(void){
-    //Read register FIDO_DATA in (3-byte * number of active LED) chunks
-    //Until FIFO_RD_PTR = FIFO_WR_PTR
-
-    uint8_t readPtr = max_read_reg(FIFO_RD_PTR_REG);
-    uint8_t writePtr = max_read_reg(FIFO_WR_PTR_REG);
-    int8_t numberOfSamples = 0;
-    //printf("Rptr: %x, wptr: %x, samples: %d \n",readPtr,writePtr,writePtr-readPtr);
-    //Do we have new data?
-    if (readPtr != writePtr){
-        //Calculate the number of readings we need to get from sensor
-        numberOfSamples = writePtr - readPtr;
-        if (numberOfSamples < 0) numberOfSamples += 32; //Wrap condition
-
-        //We now have the number of readings, now calc bytes to read
-        //For this example we are just doing Red and IR (3 bytes each)
-        uint8_t bytesLeftToRead = numberOfSamples * 2 * 3; //two is the number of active LEDs
-
-        while (bytesLeftToRead > 0){
-            uint8_t toGet = bytesLeftToRead;
-            if (toGet > I2C_BUFFER_LENGTH){
-                //If toGet is 32 this is bad because we read 6 bytes (Red+IR * 3 = 6) at a time
-                //32 % 6 = 2 left over. We don't want to request 32 bytes, we want to request 30.
-                //32 % 9 (Red+IR+GREEN) = 5 left over. We want to request 27.
-
-                toGet = I2C_BUFFER_LENGTH - (I2C_BUFFER_LENGTH % (2 * 3)); //Trim toGet to be a multiple of the samples we need to read
-            }
-            bytesLeftToRead -= toGet;
-            //printf("Toread: %d, toget %d\n",bytesLeftToRead,toGet);
-
-            while (toGet > 0){
-                // read 1 byte from registers (values are discarded)
-                uint8_t reg_INTR1 = max_read_reg(IRQ_STATUS1_REG); 
-                uint8_t reg_INTR2 = max_read_reg(IRQ_STATUS2_REG); 
-                uint8_t buffer[6];
-                max_burstRead(FIFO_DATA_REG,buffer,6);
-
-                FIFO.head++; //Advance the head of the storage struct
-                FIFO.head %= 4; //Wrap condition
-
-                //red
-                FIFO.red[FIFO.head] = (buffer[0] << 16 | buffer[1] << 8 | buffer[2]) & 0x03FFFF; //Store this reading into the sense array
-                //IR
-		        FIFO.IR[FIFO.head] = (buffer[3] << 16 | buffer[4] << 8 | buffer[5]) & 0x03FFFF;
-                
-                toGet -= 2 * 3; //Bytes read
+//Unpacks the samples the DMA read from FIFO_DATA into the circular buffer
+//Called from the DMA interrupt when the burst read ends
+static void pulse_unpackFIFO(uint8_t *data, uint32_t len, bool ok){
+    if (ok){
+        const uint8_t *end = data + len;
+        uint32_t time_ms = fifo_time_ms;
+        uint16_t head = FIFO.head;
+        uint16_t tail = FIFO.tail;
+
+        for (const uint8_t *p = data; p < end; p += 2 * 3, time_ms += MAX_SAMPLE_PERIOD_MS){
+            //Drop the sample if the main loop has not read the buffer
+            if ((uint16_t)(head - tail) >= MAX_RECORDS){
+                FIFO.overruns++;
+                continue;
             }
-        } //End while (bytesLeftToRead > 0)
-    } //End readPtr != writePtr
-    return (numberOfSamples); //Let the world know how much new data we found
-}
-
-//Check for new data but give up after a certain amount of time
-//Returns true if new data was found
-//Returns false if new data was not found
-bool pulse_waitCheck(uint8_t maxTimeToCheck)
-{
-    uint32_t start = time_us_32();
-    while(time_us_32()-start<maxTimeToCheck*1000){
-        if(pulse_checkFIFO())return true;
+            uint8_t pos = head++ & MAX_RECORDS_MASK;
+            FIFO.red[pos] = (p[0] << 16 | p[1] << 8 | p[2]) & 0x03FFFF;
+            FIFO.IR[pos] = (p[3] << 16 | p[4] << 8 | p[5]) & 0x03FFFF;
+            FIFO.time_ms[pos] = time_ms;
+        }
+        //The main loop sees the samples once they are stored
+        FIFO.head = head;
+        read_ir = true;
     }
-    printf("No data!");
-    return false;
-}
-
-//Report the most recent IR value
-uint32_t pulse_getIR(void){
-  //Check the sensor for new data for 250ms
-    if(pulse_waitCheck(250)){
-        //printf(">IR:%d,Red:%d\r\n",FIFO.IR[FIFO.head],FIFO.red[FIFO.head]);
-        return (FIFO.IR[FIFO.head]);}
-    else
-        return(0); //Sensor failed to find new data
-}
\ No newline at end of file
+    //INT still low: samples arrived during the read and there will be no other edge
+    if (!gpio_get(MAX_INT) && fifo_retries++ < 2) pulse_checkFIFO();
+    else fifo_retries = 0;
+}
+
+//Reads the status and FIFO pointers in one transaction and starts the DMA read of every
+//waiting sample, also in one transaction
+//Called from the MAX_INT interrupt
+//Returns number of samples being read
+uint16_t pulse_checkFIFO(void){
+    //IRQ_STATUS1 to FIFO_RD_PTR, reading the status clears the interrupt
+    uint8_t regs[FIFO_RD_PTR_REG + 1];
+    max_burstRead(IRQ_STATUS1_REG, regs, sizeof(regs));
+
+    uint8_t numberOfSamples = (regs[FIFO_WR_PTR_REG] - regs[FIFO_RD_PTR_REG]) & 0x1F; //Wrap condition
+    //Equal pointers with lost samples is a full FIFO
+    if (numberOfSamples == 0 && regs[OVERFLOW_COUNTER_REG]) numberOfSamples = 32;
+    if (numberOfSamples == 0) return 0;
+
+    //The newest sample was taken now, the others one period apart
+    fifo_time_ms = time_us_32()/1000 - (numberOfSamples - 1) * MAX_SAMPLE_PERIOD_MS;
+    //Red and IR, 3 bytes each
+    if (!i2c_read_nbytes_dma(I2C_PORT, MAX_ADDR, FIFO_DATA_REG, fifo_data, numberOfSamples * 2 * 3, pulse_unpackFIFO))
+        return 0;
+    return numberOfSamples;
+}
+
+uint16_t pulse_readIR(uint32_t *ir, uint16_t max, uint32_t *time_ms){
+    uint16_t tail = FIFO.tail;
+    uint16_t n = FIFO.head - tail;
+    if (n > max) n = max;
+    if (n == 0) return 0;
+
+    uint32_t first = FIFO.time_ms[tail & MAX_RECORDS_MASK];
+    uint16_t i;
+    for (i = 0; i < n; i++){
+        uint8_t pos = (tail + i) & MAX_RECORDS_MASK;
+        //Stop where samples were dropped, the caller spaces them MAX_SAMPLE_PERIOD_MS apart
+        int32_t skew = FIFO.time_ms[pos] - (first + i * MAX_SAMPLE_PERIOD_MS);
+        if (skew > MAX_SAMPLE_PERIOD_MS / 2 || skew < -MAX_SAMPLE_PERIOD_MS / 2) break;
+        ir[i] = FIFO.IR[pos];
+    }
+    *time_ms = first;
+    //The interrupt may reuse the positions once tail moves
+    FIFO.tail = tail + i;
+    return i;
+}
+
+uint16_t pulse_getOverruns(void){
+    return FIFO.overruns;
+}
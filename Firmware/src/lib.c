@@ -22,39 +22,41 @@
 #define DISP_HOR_RES 240 // Resolución horizontal del display
 #define DISP_VER_RES 240 // Resolución vertical del display
 
+// El benchmark de strips necesita buffers de hasta media pantalla
+#if STRIP_BENCH
+#define DISP_STRIP_BUF_LINES (DISP_VER_RES / 2)
+#else
+#define DISP_STRIP_BUF_LINES DISP_STRIP_LINES
+#endif
+
 static lv_disp_draw_buf_t disp_buf;
-static lv_color_t buf0[DISP_HOR_RES * DISP_VER_RES/2];
-static lv_color_t buf1[DISP_HOR_RES * DISP_VER_RES/2];
+static lv_color_t buf0[DISP_HOR_RES * DISP_STRIP_BUF_LINES];
+static lv_color_t buf1[DISP_HOR_RES * DISP_STRIP_BUF_LINES];
 static lv_disp_drv_t disp_drv;
 
 static lv_indev_drv_t indev_en;
 static lv_group_t *group;
-static lv_obj_t *screen1;
-static lv_obj_t *label_steps;
-static lv_obj_t *label_time;
-static lv_obj_t *label_date;
-static lv_obj_t *label_battery;
-static lv_obj_t *label_calories;
-static lv_obj_t *label_distance;
-static lv_obj_t *label_heart;
-
-static lv_obj_t *bar_steps;
-
 
-static lv_obj_t *arc_calories, *arc_distance;
+static struct repeating_timer ms_timer;
+static alarm_id_t render_alarm;
 
-static lv_obj_t *heart_circle;
-static lv_obj_t *label_pulse;
+static render_stats_t render_stats;
+static uint32_t flush_start_us;
 
+static sched_mode_t sched_mode = SCHED_FULL;
+static uint32_t sched_mode_since_us;
+static sched_stats_t sched_stats;
 
-static struct repeating_timer lvgl_timer;
-static struct repeating_timer ms_timer;
+#if LV_DRAW_CORES > 1
+static uint32_t core1_stack[RENDER_CORE1_STACK_WORDS];
+#endif
 
 static void disp_flush_cb(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
+static void disp_monitor_cb(lv_disp_drv_t * disp, uint32_t time, uint32_t px);
 
-static void dma_handler(void);
+static void disp_flush_done(void);
+static void sched_set_mode(sched_mode_t mode);
 static void timer_callback(lv_timer_t * timer);
-static void create_screen1 (void);
 static void create_screen2 (void);
 
 datetime_t t ={
@@ -89,148 +91,444 @@ static void config_clocks (void) {
 
 void disp_flush_cb(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
 {
-    // Configurar la ventana de dibujo en la pantalla
-    LCD_1IN28_SetWindows(area->x1, area->y1, area->x2, area->y2);
-    
-    // Enviar datos utilizando DMA
-    dma_channel_configure(
-        dma_tx,
-        &c,
-        (volatile void *)&spi_get_hw(SPI_PORT)->dr, // Dirección destino: Registro SPI
-        color_p,                                    // Dirección fuente: Buffer de color
-        ((area->x2 + 1 - area-> x1)*(area->y2 + 1 - area -> y1))*2, // Cantidad de datos
-        true); // Iniciar transferencia automáticamente
+    flush_start_us = time_us_32();
+
+    // Ventana y pixeles se envian como una sola secuencia asíncrona,
+    // los RGB565 salen en tramas de 16 bits sin necesidad de swap si LCD_SPI_16BIT o LCD_PIO
+    uint32_t sent = LCD_DrawArea(area->x1, area->y1, area->x2, area->y2, (const uint16_t *)color_p, disp_flush_done);
+
+    render_stats.flush_bytes += sent * 2;
+    render_stats.dma_xfers += sent * LCD_DMA_XFERS_PER_PIXEL;
+}
+
+#if LV_DRAW_CORES > 1
+/**
+ * @brief Bucle del core 1: renderiza las bandas que LVGL le pasa desde el core 0.
+ * 
+ * Recibe por el FIFO entre cores la función de render y su parámetro, y responde
+ * con el tiempo en us que tardó en renderizar la banda.
+ */
+static void render_core1_main(void)
+{
+#if LV_USE_GPU_RP2040_INTERP
+    lv_gpu_rp2040_interp_init(); // Los interpoladores son de cada core
+#endif
+    while (true) {
+        void (*render_cb)(void *) = (void (*)(void *))multicore_fifo_pop_blocking();
+        void *param = (void *)multicore_fifo_pop_blocking();
+
+        uint32_t start_us = time_us_32();
+        render_cb(param);
+#if DISP_DMA_GPU
+        DMA_GPU_Wait(); // La banda queda lista cuando el DMA del core 1 termina
+#endif
+        multicore_fifo_push_blocking(time_us_32() - start_us);
+    }
+}
+
+/**
+ * @brief Callback de LVGL que arranca el render de una banda en el core 1.
+ * 
+ * @param disp driver del display.
+ * @param render_cb función que renderiza la banda.
+ * @param param parámetro de @p render_cb.
+ * 
+ * @return true, el core 1 siempre está disponible para LVGL.
+ */
+static bool disp_render_start_cb(lv_disp_drv_t *disp, void (*render_cb)(void *), void *param)
+{
+    multicore_fifo_push_blocking((uint32_t)render_cb);
+    multicore_fifo_push_blocking((uint32_t)param);
+    return true;
+}
+
+/**
+ * @brief Callback de LVGL que espera a que el core 1 termine su banda.
+ * 
+ * @param disp driver del display.
+ */
+static void disp_render_wait_cb(lv_disp_drv_t *disp)
+{
+    uint32_t start_us = time_us_32();
+    uint32_t core1_us = multicore_fifo_pop_blocking();
+
+    render_stats.core1_bands++;
+    render_stats.core1_us += core1_us;
+    render_stats.core1_wait_us += time_us_32() - start_us;
+}
+#endif
+
+#if DISP_DMA_GPU
+/**
+ * @brief Callback de LVGL que rellena un area del buffer de dibujo con el DMA.
+ * 
+ * Retorna sin esperar, LVGL llama a @ref disp_gpu_wait_cb antes de volver a tocar el buffer.
+ * 
+ * @param disp driver del display.
+ * @param dest_buf buffer de dibujo.
+ * @param dest_width ancho en pixeles del buffer.
+ * @param fill_area area a rellenar, relativa al buffer.
+ * @param color color del relleno.
+ */
+static void disp_gpu_fill_cb(lv_disp_drv_t *disp, lv_color_t *dest_buf, lv_coord_t dest_width,
+                             const lv_area_t *fill_area, lv_color_t color)
+{
+    lv_color_t *dest = dest_buf + dest_width * fill_area->y1 + fill_area->x1;
+
+    DMA_GPU_Fill((uint16_t *)dest, dest_width, lv_area_get_width(fill_area), lv_area_get_height(fill_area),
+                 color.full);
+}
+
+/**
+ * @brief Callback de LVGL que copia pixeles opacos a un area del buffer de dibujo con el DMA.
+ * 
+ * Solo retorna sin esperar si el origen es una imagen en la flash. Los demás origenes son
+ * buffers temporales de LVGL que se reescriben apenas retorna la llamada.
+ * 
+ * @param disp driver del display.
+ * @param dest_buf buffer de dibujo.
+ * @param dest_width ancho en pixeles del buffer.
+ * @param copy_area area a copiar, relativa al buffer.
+ * @param src_buf primer pixel a copiar.
+ * @param src_width ancho en pixeles del origen.
+ */
+static void disp_gpu_copy_cb(lv_disp_drv_t *disp, lv_color_t *dest_buf, lv_coord_t dest_width,
+                             const lv_area_t *copy_area, const lv_color_t *src_buf, lv_coord_t src_width)
+{
+    lv_color_t *dest = dest_buf + dest_width * copy_area->y1 + copy_area->x1;
+
+    DMA_GPU_Copy((uint16_t *)dest, dest_width, (const uint16_t *)src_buf, src_width,
+                 lv_area_get_width(copy_area), lv_area_get_height(copy_area));
+    if ((uintptr_t)src_buf < XIP_BASE || (uintptr_t)src_buf >= SRAM_BASE) DMA_GPU_Wait();
+}
+
+/**
+ * @brief Callback de LVGL que espera los rellenos y copias del core que llama.
+ * 
+ * @param disp driver del display.
+ */
+static void disp_gpu_wait_cb(lv_disp_drv_t *disp)
+{
+    DMA_GPU_Wait();
+}
+#endif
+
+/**
+ * @brief Callback de LVGL llamado al final de cada refresco.
+ * 
+ * Acumula el número de pixeles enviados y los que se ahorraron respecto a redibujar
+ * toda la pantalla, para ser reportados por @see report_render_stats().
+ * 
+ * @param disp driver del display.
+ * @param time tiempo de render y envío del refresco en ms.
+ * @param px número de pixeles redibujados en el refresco.
+ */
+static void disp_monitor_cb(lv_disp_drv_t *disp, uint32_t time, uint32_t px)
+{
+    uint32_t full = (uint32_t)disp->hor_res * disp->ver_res;
+
+    render_stats.refreshes++;
+    render_stats.px_flushed += px;
+    render_stats.px_saved += (px < full) ? full - px : 0;
+    render_stats.time_ms += time;
+#if XIP_PROFILE
+    render_stats.xip_acc += xip_ctrl_hw->ctr_acc;
+    render_stats.xip_hit += xip_ctrl_hw->ctr_hit;
+#endif
 }
 
-static void dma_handler(void)
+/**
+ * @brief Imprime y reinicia las estadisticas de refresco acumuladas.
+ */
+static void report_render_stats(void)
 {
-    uint32_t status = dma_channel_get_irq0_status(dma_tx);
-    //printf("status: %08x\n", status);
-    if (status) {
-        dma_channel_acknowledge_irq0(dma_tx);
-        lv_disp_flush_ready(&disp_drv);         /* Indicate you are ready with the flushing*/
-        //printf("DMA transfer complete\n");
+#if RENDER_STATS
+    uint32_t full = render_stats.refreshes * DISP_HOR_RES * DISP_VER_RES;
+
+    if (render_stats.refreshes) {
+        printf("refr: %d, px: %d, saved px: %d (%d%%), time: %dms\n",
+               render_stats.refreshes, render_stats.px_flushed, render_stats.px_saved,
+               (int)((uint64_t)render_stats.px_saved * 100 / full), render_stats.time_ms);
+        if (render_stats.flush_us) {
+            printf("%s %d bits: %d bytes, %d dma xfers, %dus, %d KB/s\n",
+                   LCD_PIO ? "pio" : "spi", LCD_PIXEL_BITS, render_stats.flush_bytes, render_stats.dma_xfers,
+                   render_stats.flush_us,
+                   (int)((uint64_t)render_stats.flush_bytes * 1000 / 1024 * 1000 / render_stats.flush_us));
+        }
+#if LV_DRAW_CORES > 1
+        // Sin el core 1 su tiempo de render se sumaría al refresco y no habría espera
+        uint32_t dual_us = render_stats.time_ms * 1000;
+        uint32_t single_us = dual_us + render_stats.core1_us - render_stats.core1_wait_us;
+        if (dual_us) {
+            printf("core1: %d bands, %dus render, %dus wait, speedup x%d.%02d\n",
+                   render_stats.core1_bands, render_stats.core1_us, render_stats.core1_wait_us,
+                   single_us / dual_us, single_us % dual_us * 100 / dual_us);
+        }
+#endif
+#if XIP_PROFILE
+        if (render_stats.xip_acc) {
+            uint32_t misses = render_stats.xip_acc - render_stats.xip_hit;
+            printf("xip (%s): %d accesses/frame, %d misses/frame, hit %d.%d%%\n", FAST_MEM_RAM ? "ram" : "flash",
+                   render_stats.xip_acc / render_stats.refreshes, misses / render_stats.refreshes,
+                   (int)((uint64_t)render_stats.xip_hit * 100 / render_stats.xip_acc),
+                   (int)((uint64_t)render_stats.xip_hit * 1000 / render_stats.xip_acc % 10));
+        }
+#endif
+#if DISP_DMA_GPU
+        dma_gpu_stats_t gpu;
+        DMA_GPU_GetStats(&gpu, true);
+        if (gpu.jobs) {
+            printf("dma gpu: %d jobs, %d px (+%d px by cpu), %d waits, %dus wait\n",
+                   gpu.jobs, gpu.px, gpu.cpu_px, gpu.waits, gpu.wait_us);
+        }
+#endif
+#if LV_GLYPH_SPRITE_CACHE_SIZE > 0
+        lv_glyph_sprite_stats_t sprites;
+        lv_draw_letter_sprite_stats(&sprites, true);
+        if (sprites.hits + sprites.misses + sprites.skips) {
+            printf("glyph sprites: %d hits, %d misses, %d skips\n", sprites.hits, sprites.misses, sprites.skips);
+        }
+#endif
+#if LV_MEM_BUF_ARENA_SIZE > 0
+        lv_mem_buf_arena_stats_t arena;
+        lv_mem_buf_arena_stats(&arena, true);
+        printf("draw arena: %d/%d bytes high water, %d heap fallbacks\n", arena.high_water, arena.size,
+               arena.fallbacks);
+#endif
+        pulse_stats_t pulse;
+        get_pulse_stats(&pulse, true);
+        if (pulse.steps) {
+            printf("pulse %s: %d steps, %dus anim, %d draws, %dus draw, %dus/step\n",
+                   PULSE_SPRITE ? "sprite" : "styles", pulse.steps, pulse.anim_us, pulse.draws, pulse.draw_us,
+                   (pulse.anim_us + pulse.draw_us) / pulse.steps);
+        }
+#if DISP_ROUND
+        uint32_t area_bytes = render_stats.px_flushed * 2;
+        if (area_bytes > render_stats.flush_bytes) {
+            printf("round clip: %d bytes saved/frame\n",
+                   (area_bytes - render_stats.flush_bytes) / render_stats.refreshes);
+        }
+#endif
     } else {
-        //printf("no DMA interrupt triggered. \n");
+        printf("refr: 0, idle\n");
+    }
+#endif
+    memset(&render_stats, 0, sizeof(render_stats));
+}
+
+#if STRIP_BENCH
+/**
+ * @brief Mide el tiempo por cuadro completo con distintos altos de strip.
+ * 
+ * Redibuja toda la pantalla @ref STRIP_BENCH_FRAMES veces con cada alto y reporta el tiempo
+ * promedio por cuadro junto a la RAM que ocupan los dos strips, para escoger @ref DISP_STRIP_LINES.
+ * Al terminar deja los strips con @ref DISP_STRIP_LINES lineas.
+ */
+static void strip_bench(void)
+{
+    static const uint16_t bench_lines[] = {10, 20, 30, 40, 60, 80, 120};
+    const uint32_t half_screen_ram = 2 * DISP_HOR_RES * (DISP_VER_RES / 2) * sizeof(lv_color_t);
+
+    for (uint8_t i = 0; i < sizeof(bench_lines) / sizeof(bench_lines[0]); i++) {
+        uint16_t lines = bench_lines[i];
+        if (lines > DISP_STRIP_BUF_LINES) break;
+
+        lv_disp_draw_buf_init(&disp_buf, buf0, buf1, DISP_HOR_RES * lines);
+
+        uint32_t start_us = time_us_32();
+        for (uint8_t f = 0; f < STRIP_BENCH_FRAMES; f++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        while (disp_buf.flushing) tight_loop_contents();
+        uint32_t frame_us = (time_us_32() - start_us) / STRIP_BENCH_FRAMES;
+
+        uint32_t ram = 2 * DISP_HOR_RES * lines * sizeof(lv_color_t);
+        printf("strip %3d lines: %6d B RAM (%6d B freed), %6d us/frame, %3d fps\n",
+               lines, ram, half_screen_ram - ram, frame_us, 1000000 / frame_us);
+    }
+
+    lv_disp_draw_buf_init(&disp_buf, buf0, buf1, DISP_HOR_RES * DISP_STRIP_LINES);
+    memset(&render_stats, 0, sizeof(render_stats));
+}
+#endif
+
+#if BLEND_BENCH && LV_USE_GPU_RP2040_INTERP
+/**
+ * @brief Mide un caso de @ref blend_bench.
+ * 
+ * Mezcla sobre buf0, que se llena con un degradado antes de cada repetición, linea por linea
+ * como lo hace LVGL al dibujar rectangulos e imagenes.
+ * 
+ * @param map imagen de DISP_HOR_RES x DISP_STRIP_LINES a mezclar, NULL para llenar con un color.
+ * @param mask mascara de una linea, NULL sin mascara.
+ * @param opa opacidad de la mezcla.
+ * @return tiempo promedio en us de mezclar el strip completo.
+ */
+static uint32_t blend_bench_case(const lv_color_t *map, lv_opa_t *mask, lv_opa_t opa)
+{
+    lv_area_t clip = {0, 0, DISP_HOR_RES - 1, DISP_STRIP_LINES - 1};
+    lv_draw_mask_res_t mask_res = mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+    lv_color_t color = lv_color_make(0x20, 0xA0, 0xF0);
+    uint32_t total_us = 0;
+
+    for (uint8_t run = 0; run < BLEND_BENCH_RUNS; run++) {
+        for (uint32_t i = 0; i < DISP_HOR_RES * DISP_STRIP_LINES; i++) {
+            buf0[i] = lv_color_make(i % DISP_HOR_RES, i / DISP_HOR_RES * 6, 255 - i % DISP_HOR_RES);
+        }
+
+        uint32_t start_us = time_us_32();
+        for (lv_coord_t y = 0; y < DISP_STRIP_LINES; y++) {
+            lv_area_t line = {0, y, DISP_HOR_RES - 1, y};
+            if (map) _lv_blend_map(&clip, &line, map + y * DISP_HOR_RES, mask, mask_res, opa, LV_BLEND_MODE_NORMAL);
+            else _lv_blend_fill(&clip, &line, color, mask, mask_res, opa, LV_BLEND_MODE_NORMAL);
+        }
+        total_us += time_us_32() - start_us;
+    }
+    return total_us / BLEND_BENCH_RUNS;
+}
+
+/**
+ * @brief Compara las mezclas de LVGL por software y con los interpoladores.
+ * 
+ * Llena y copia un strip con opacidad, con una mascara en rampa y con ambas, primero por
+ * software y luego con los interpoladores, y reporta el tiempo de cada caso. Usa buf1 como
+ * imagen, por eso corre antes del primer render.
+ */
+static void blend_bench(void)
+{
+    static const struct {
+        const char *name;
+        bool map;
+        bool mask;
+        lv_opa_t opa;
+    } cases[] = {
+        {"fill opa", false, false, LV_OPA_50},
+        {"fill mask", false, true, LV_OPA_COVER},
+        {"fill mask+opa", false, true, LV_OPA_50},
+        {"map opa", true, false, LV_OPA_50},
+        {"map mask", true, true, LV_OPA_COVER},
+        {"map mask+opa", true, true, LV_OPA_50},
+    };
+    static lv_opa_t mask[DISP_HOR_RES];
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+    lv_area_t area = draw_buf->area;
+    void *buf_act = draw_buf->buf_act;
+    uint32_t seed = 1;
+
+    for (uint16_t x = 0; x < DISP_HOR_RES; x++) mask[x] = x * LV_OPA_COVER / (DISP_HOR_RES - 1);
+    for (uint32_t i = 0; i < DISP_HOR_RES * DISP_STRIP_LINES; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf1[i].full = seed >> 16;
+    }
+
+    // LVGL mezcla sobre el buffer activo del display que se está refrescando
+    lv_area_set(&draw_buf->area, 0, 0, DISP_HOR_RES - 1, DISP_STRIP_LINES - 1);
+    draw_buf->buf_act = buf0;
+    _lv_refr_set_disp_refreshing(disp);
+
+    for (uint8_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const lv_color_t *map = cases[i].map ? buf1 : NULL;
+        lv_opa_t *case_mask = cases[i].mask ? mask : NULL;
+
+        lv_gpu_rp2040_interp_enable(false);
+        uint32_t sw_us = blend_bench_case(map, case_mask, cases[i].opa);
+        lv_gpu_rp2040_interp_enable(true);
+        uint32_t interp_us = blend_bench_case(map, case_mask, cases[i].opa);
+
+        printf("blend %-13s: sw %5d us, interp %5d us\n", cases[i].name, sw_us, interp_us);
     }
+
+    _lv_refr_set_disp_refreshing(NULL);
+    draw_buf->area = area;
+    draw_buf->buf_act = buf_act;
 }
+#endif
 
-static void heart_pulse_cb(void *obj, int32_t value) {
-    lv_obj_set_style_radius(obj, value, 0);
-    lv_obj_set_size(obj, value *2, value *2);
-    lv_obj_align(obj, LV_ALIGN_CENTER, 50, -10);
+/**
+ * @brief Imprime y reinicia los tiempos del planificador de render.
+ * 
+ * Por cada modo reporta el tiempo que estuvo activo, las veces que corrió LVGL y el
+ * porcentaje de ese tiempo en que la CPU estuvo despierta.
+ */
+static void report_sched_stats(void)
+{
+#if RENDER_STATS
+    static const char *mode_names[SCHED_MODES] = {"full", "idle"};
+
+    sched_set_mode(sched_mode); // Cierra el tramo del modo actual
+    for (uint8_t mode = 0; mode < SCHED_MODES; mode++) {
+        if (sched_stats.time_us[mode] == 0) continue;
+        printf("sched %s: %dms, %d runs, busy %d%%\n", mode_names[mode],
+               sched_stats.time_us[mode] / 1000, sched_stats.runs[mode],
+               (int)((uint64_t)sched_stats.busy_us[mode] * 100 / sched_stats.time_us[mode]));
+    }
+#endif
+    memset(&sched_stats, 0, sizeof(sched_stats));
 }
 
-static void create_heart_pulse_indicator (lv_obj_t *parent) {
-    heart_circle = lv_obj_create(parent);
-    lv_obj_set_size(heart_circle, 10, 10);
-    lv_obj_set_style_radius(heart_circle, 5, 0);
-    lv_obj_set_style_bg_color(heart_circle, lv_palette_main(LV_PALETTE_RED), 0);
-    lv_obj_align(heart_circle, LV_ALIGN_CENTER, 50, -10);
-
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_var(&a, heart_circle);
-    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)heart_pulse_cb);
-    lv_anim_set_values(&a, 13, 17);
-    lv_anim_set_time(&a, 400);
-    lv_anim_set_playback_time(&a, 400);
-    lv_anim_set_playback_time(&a, 400);
-    lv_anim_set_repeat_delay(&a, 200);
-    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_start(&a);
-
-    label_pulse = lv_label_create(parent);
-    lv_label_set_text(label_pulse, "70 bpm");
-    lv_obj_set_style_text_font(label_pulse, &lv_font_montserrat_10, 0);
-    lv_obj_align_to(label_pulse, heart_circle, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
+/**
+ * @brief Llamada desde la interrupción del DMA cuando la cola del LCD terminó de enviar el area.
+ */
+static void disp_flush_done(void)
+{
+    render_stats.flush_us += time_us_32() - flush_start_us;
+    lv_disp_flush_ready(&disp_drv);         /* Indicate you are ready with the flushing*/
 }
 
-static void create_screen1 (void) {
-    
-    screen1 = lv_obj_create(NULL);
-
-    // WIDGET DE LA HORA
-    label_time = lv_label_create(screen1);
-    lv_label_set_text(label_time, "15:45");
-    lv_obj_set_style_text_font(label_time, &lv_font_montserrat_48, 0);
-    lv_obj_align(label_time, LV_ALIGN_CENTER, 0, -70);
-
-    // WIDGET DE LA FECHA (DEBAJO DE LA HORA)
-    label_date = lv_label_create(screen1);
-    lv_label_set_text(label_date, "10/12/2024 WED");
-    lv_obj_set_style_text_font(label_date, &lv_font_montserrat_18, 0);
-    lv_obj_align(label_date, LV_ALIGN_CENTER, 0, -40);
-
-
-    // WIDGET DE LA BATERIA
-    label_battery = lv_label_create(screen1);
-    lv_label_set_text(label_battery, LV_SYMBOL_BATTERY_FULL "100%");
-    lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -90, 7);
-
-    // BARRA DE PROGRESO DE LOS PASOS
-    bar_steps = lv_bar_create(screen1);
-    lv_obj_set_size(bar_steps, 100, 20);
-    lv_bar_set_range(bar_steps, 0, 1000);
-    lv_bar_set_value(bar_steps, 0, LV_ANIM_OFF);
-    lv_obj_align(bar_steps, LV_ALIGN_CENTER, -50, -10);
-
-    label_steps = lv_label_create(screen1);
-    lv_label_set_text(label_steps, "Steps: 0");
-    lv_obj_set_style_text_font(label_steps, &lv_font_montserrat_10, 0);
-    lv_obj_align_to(label_steps, bar_steps, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-
-
-    // WIDGET DE LAS CALORIAS
-    arc_calories = lv_arc_create(screen1);
-    lv_obj_set_size(arc_calories, 45, 45);
-    lv_arc_set_rotation(arc_calories, 270);
-    lv_arc_set_bg_angles(arc_calories, 0, 360);
-    lv_obj_remove_style(arc_calories, NULL, LV_PART_KNOB);
-    lv_arc_set_value(arc_calories, 0);
-    lv_obj_align(arc_calories, LV_ALIGN_CENTER, -40, 45);
-
-    label_calories = lv_label_create(screen1);
-    lv_label_set_text(label_calories, "0");
-    lv_obj_set_style_text_font(label_calories, &lv_font_montserrat_10, 0);
-    lv_obj_align_to(label_calories, arc_calories, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-
-
-    // WIDGET DE LA DISTANCIA
-    arc_distance = lv_arc_create(screen1);
-    lv_obj_set_size(arc_distance, 45, 45);
-    lv_arc_set_rotation(arc_distance, 270);
-    lv_arc_set_bg_angles(arc_distance, 0, 360);
-    lv_obj_remove_style(arc_distance, NULL, LV_PART_KNOB);
-    lv_arc_set_value(arc_distance, 0);
-    lv_obj_align(arc_distance, LV_ALIGN_CENTER, 40, 45);
-
-    label_distance = lv_label_create(screen1);
-    lv_label_set_text(label_distance, "0m");
-    lv_obj_set_style_text_font(label_distance, &lv_font_montserrat_10, 0);
-    lv_obj_align_to(label_distance, arc_distance, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-
-    //Heart Pulse Indicator
-    create_heart_pulse_indicator(screen1);
+/**
+ * @brief Alarma del planificador: pide correr LVGL en el bucle principal.
+ */
+static int64_t render_alarm_cb(alarm_id_t id, void *user_data) {
+    render_alarm = 0;
+    flags.render = 1;
+    return 0;
+}
 
+/**
+ * @brief Cambia el modo del planificador acumulando el tiempo pasado en el modo anterior.
+ * 
+ * @param mode nuevo modo.
+ */
+static void sched_set_mode(sched_mode_t mode) {
+    uint32_t now_us = time_us_32();
 
+    sched_stats.time_us[sched_mode] += now_us - sched_mode_since_us;
+    sched_mode_since_us = now_us;
+    sched_mode = mode;
 }
 
-static bool repeating_lvgl_timer_callback (struct repeating_timer *t) {
-    lv_tick_inc(5);
-    flags.five_mil=true;
-    return true;
+/**
+ * @brief Corre LVGL y programa con una alarma el siguiente render.
+ * 
+ * Mientras haya animaciones o areas invalidadas sin dibujar, el siguiente render es cuando
+ * LVGL lo pide (retorno de lv_timer_handler()). Si la pantalla es estática se espera
+ * @ref SCHED_IDLE_PERIOD_MS; los cambios de los widgets llegan antes por las banderas de los timers.
+ */
+static void render_run(void) {
+#if XIP_PROFILE
+    // Cuenta los accesos al XIP desde aquí hasta el monitor_cb del refresco, escribir los pone en 0
+    xip_ctrl_hw->ctr_acc = 0;
+    xip_ctrl_hw->ctr_hit = 0;
+#endif
+    uint32_t delay_ms = lv_timer_handler();
+    sched_mode_t mode = (lv_anim_count_running() || lv_disp_get_default()->inv_p) ? SCHED_FULL : SCHED_IDLE;
+
+    if (mode == SCHED_IDLE) delay_ms = SCHED_IDLE_PERIOD_MS;
+    if (mode != sched_mode) sched_set_mode(mode);
+    sched_stats.runs[mode]++;
+
+    if (render_alarm) cancel_alarm(render_alarm);
+    render_alarm = add_alarm_in_ms(delay_ms, render_alarm_cb, NULL, true);
 }
 
 static bool repeating_500ms_timer_callback(struct repeating_timer *t){
-    static uint8_t count;
     static bool halfy;
-    count=(count+1)%3;
     halfy=~halfy;
 
     flags.half=1;
     if (halfy) flags.full=1;
-    if (count==2) flags.one_half=1;
 
     return true;
 }
@@ -245,6 +543,8 @@ void smartwatch_init(){
 
     // Inicialización del hardware
     LCD_init(HORIZONTAL);
+    // La pantalla se limpia por DMA mientras se inicializan los sensores
+    LCD_FillRect(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, BLACK, NULL);
     set_pwm(100);
     QMI8658_init();
     max_init();
@@ -253,31 +553,56 @@ void smartwatch_init(){
     DS1302_init(&t,USB_CONFIG);
 
 
-    add_repeating_timer_ms(5, repeating_lvgl_timer_callback, NULL, &lvgl_timer);
-
     //let's see if this breaks everything! yay!
     add_repeating_timer_ms(500, repeating_500ms_timer_callback, NULL, &ms_timer);
 
-    // Inicialización de LVGL
+    // Inicialización de LVGL, el spinlock protege su heap cuando renderizan los dos cores
+#if LV_DRAW_CORES > 1
+    spin_lock_claim(PICO_SPINLOCK_ID_OS1);
+#endif
+    // El primer flush necesita la cola del LCD libre
+    while (LCD_QueueBusy()) tight_loop_contents();
     lv_init();
+#if LV_USE_GPU_RP2040_INTERP
+    lv_gpu_rp2040_interp_init();
+#endif
 
-    lv_disp_draw_buf_init(&disp_buf, buf0, buf1, DISP_HOR_RES * DISP_VER_RES / 2); 
+    lv_disp_draw_buf_init(&disp_buf, buf0, buf1, DISP_HOR_RES * DISP_STRIP_LINES); 
     lv_disp_drv_init(&disp_drv);    
     disp_drv.flush_cb = disp_flush_cb;
     disp_drv.draw_buf = &disp_buf;        
     disp_drv.hor_res = DISP_HOR_RES;
     disp_drv.ver_res = DISP_VER_RES;
+    disp_drv.monitor_cb = disp_monitor_cb;
+    disp_drv.circle_clip = DISP_ROUND;
+#if DISP_DMA_GPU
+    // Canales para cada core que renderiza, antes de arrancar el core 1
+    DMA_GPU_init(LV_DRAW_CORES);
+    disp_drv.gpu_fill_cb = disp_gpu_fill_cb;
+    disp_drv.gpu_copy_cb = disp_gpu_copy_cb;
+    disp_drv.gpu_wait_cb = disp_gpu_wait_cb;
+#endif
+#if LV_DRAW_CORES > 1
+    multicore_launch_core1_with_stack(render_core1_main, core1_stack, sizeof(core1_stack));
+    disp_drv.render_start_cb = disp_render_start_cb;
+    disp_drv.render_wait_cb = disp_render_wait_cb;
+#endif
     lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
-
-    dma_channel_set_irq0_enabled(dma_tx, true);
-    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
-    irq_set_enabled(DMA_IRQ_0, true);
+    LCD_SetRoundClip(DISP_ROUND, DISP_HOR_RES, DISP_VER_RES);
 
     // Crear las pantallas
     create_screen1();
 
     // Inicializar la pantalla
     lv_scr_load(screen1);
+    sched_mode_since_us = time_us_32();
+
+#if STRIP_BENCH
+    strip_bench();
+#endif
+#if BLEND_BENCH && LV_USE_GPU_RP2040_INTERP
+    blend_bench();
+#endif
 
     printf("DMA status: %08x\n", dma_channel_get_irq0_status(dma_tx));
 
@@ -300,139 +625,25 @@ void check_for_new_day(datetime_t*now){
     }
 }
 
-void save_steps(uint32_t offset, uint32_t*steps){
-    *steps=offset+*steps;
-    
-    uint8_t step_low = *steps & 0xFF;
-    uint8_t step_mid = (*steps>>8) & 0xFF;
-    uint8_t step_high = (*steps>>16) &0XFF; 
-
-    //escritura en memoria
-    SetMemory(4,step_low);
-    SetMemory(5,step_mid);
-    SetMemory(6,step_high);  
-}
-
-void update_steps(uint32_t*steps,uint32_t offset){
-    *steps = read_imu_step_count();
-    save_steps(offset,steps);
-    char steps_str[32];
-    snprintf(steps_str, 64, "Steps: %d", (*steps%1001)); //texto de abajo
-    //printf("udapted text: %s\n", steps_str);
-
-    lv_bar_set_value(bar_steps, *steps, LV_ANIM_OFF);
-
-    lv_label_set_text(label_steps, steps_str);
-    lv_obj_align_to(label_steps, bar_steps, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-
-}
-
-void update_time(datetime_t*now){
-    const char* dotw_lookup[] = {"SUN","MON","TUE","WED", "THU", "FRI","SUN"};
-    GetDateTime(now);
-
-    //hour and minutes section
-    char time_str[32];
-    snprintf(time_str, 64, "%.2d:%.2d",now->hour,now->min); //texto de abajo
-
-    lv_label_set_text(label_time, time_str);
-    lv_obj_align(label_time, LV_ALIGN_CENTER, 0, -70);
-
-    //date section
-    snprintf(time_str, 64,"%.2d/%.2d/%.4d %.3s",now->day,now->month,now->year,dotw_lookup[now->dotw]); //texto de abajo
-
-    // WIDGET DE LA FECHA (DEBAJO DE LA HORA)
-    lv_label_set_text(label_date, time_str);
-    lv_obj_align(label_date, LV_ALIGN_CENTER, 0, -40);
-}
-
-void update_distance(uint32_t steps){
-    uint8_t height=GetMemory(2);
-    uint32_t distance=steps*height*0.414/100; //size of step according to height in m
-    uint8_t angle=(100*distance/750)%101; //750m is the top distance to show
-    
-    lv_arc_set_value(arc_distance, angle);
-    lv_obj_align(arc_distance, LV_ALIGN_CENTER, 40, 45);
-
-    //hour and minutes section
-    char dist_str[32];
-    snprintf(dist_str, 64, "%dm",distance); //texto de abajo
-
-    lv_label_set_text(label_distance,dist_str);
-    lv_obj_align_to(label_distance, arc_distance, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-}
-
-void update_battery(){
-    char symbol[12];
-
-    uint16_t voltage = 33*adc_read() / (1 << 12) * 2;
-    uint16_t percent=100*(voltage - 30) / (40 - 30);
-    //printf("v:%d,p:%d\n",voltage,percent);
-    
-    if(voltage>=40){
-        percent=100;
-        strcpy(symbol, LV_SYMBOL_BATTERY_FULL);
-    }else if(voltage>=37){
-        strcpy(symbol, LV_SYMBOL_BATTERY_3);
-    }else if(voltage>=35){
-        strcpy(symbol, LV_SYMBOL_BATTERY_2);
-    }else if(voltage>=30){
-        strcpy(symbol, LV_SYMBOL_BATTERY_1);
-    }else if(voltage>=25){
-        strcpy(symbol, LV_SYMBOL_BATTERY_EMPTY);
-    }
-
-    char per_str[10];
-    snprintf(per_str, 16, "%d%%",percent); //texto de abajo
-    strcat(symbol, per_str);
-
-    lv_label_set_text(label_battery, symbol);
-    lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -90, 7);
-
-}
-
-void update_hr(uint8_t bpm){
-    char bpm_str[3];
-    snprintf(bpm_str, 64, "%d",bpm); //texto de abajo
-
-    lv_label_set_text(label_pulse, bpm_str);
-    lv_obj_align_to(label_pulse, heart_circle, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
-}
-
-void update_calories(uint32_t steps,uint8_t bpm){
-    uint8_t weight=GetMemory(1);
-    uint8_t height=GetMemory(2);
-    uint8_t age=GetMemory(3);
-    uint32_t dist=steps*height*0.414/100; //size of step according to height in m
-    uint32_t cals=(dist/0.13)*(0.6309*bpm+0.1988*weight+0.2017*age-55.0969)/4.184;
-    uint8_t cals_per=cals*100/150000; //let's say that the max is 250 kcals
-
-    char cals_str[3];
-    snprintf(cals_str, 64, "%dcals",cals); //texto de abajo
-
-    lv_arc_set_value(arc_calories, cals_per);
-    lv_obj_align(arc_calories, LV_ALIGN_CENTER, -40, 45);
-
-    lv_label_set_text(label_calories, cals_str);
-    lv_obj_align_to(label_calories, arc_calories, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
-
-}
-
 void end_screen(){
+#if !RENDER_DIRTY_ONLY
     lv_obj_invalidate(screen1);
-    lv_task_handler(); //esto tiene que suceder cada 5ms
+#endif
+    render_run();
 }
 
 int smartwatch_main(void){
     smartwatch_init();
     flags.half=0;
     flags.full=0;
-    flags.one_half=0;
+    flags.render=1;
     uint32_t offset=read_steps_rtc();
     printf("Actual offset:%d\n",offset);
     //inicialización de las variables de lectura de datos
     uint32_t steps = 0;
     uint8_t bpm=70;
+    bool hr_lost=false;
+    uint16_t pulse_overruns=0;
     datetime_t now;
     GetDateTime(&now); //para evitar un bucle infinito
     printf("Set day: %d\n",now.day);
@@ -440,11 +651,34 @@ int smartwatch_main(void){
     // Bucle principal para LVGL
     while (true)
     {
-        if(flags.five_mil | flags.full | flags.half | flags.one_half | pulse_getIR_flag()){
+        if(flags.render | flags.full | flags.half | pulse_getIR_flag()){
+            uint32_t wake_us = time_us_32();
             if(pulse_getIR_flag()){
-
-                add_sample(pulse_getIR());
+                // La interrupción del MAX30102 ya leyó las muestras, aquí solo se procesan
                 pulse_setIR_flag(false);
+                uint32_t ir[PULSE_BLOCK];
+                uint32_t ir_ms;
+                uint16_t n;
+                while((n=pulse_readIR(ir,PULSE_BLOCK,&ir_ms))) add_samples_at(ir,n,ir_ms,MAX_SAMPLE_PERIOD_MS);
+                uint16_t overruns=pulse_getOverruns();
+                if(overruns!=pulse_overruns){
+                    printf("MAX30102: %d samples dropped, main loop too slow\n",(uint16_t)(overruns-pulse_overruns));
+                    pulse_overruns=overruns;
+                }
+                // El pulso se actualiza en cada latido detectado
+                pulse_beat_t beat;
+                if(pulse_get_beat(&beat)){
+                    bpm=beat.bpm;
+                    update_hr(bpm);
+                    hr_lost=false;
+                    end_screen();
+                }
+                // Sin latidos, por ejemplo al quitar el dedo, el pulso se muestra perdido una vez
+                else if(!hr_lost && calculate_heart_rate()==PULSE_LOST){
+                    update_hr(PULSE_LOST);
+                    hr_lost=true;
+                    end_screen();
+                }
             }
             if(flags.half){
                 update_steps(&steps,offset);
@@ -456,23 +690,18 @@ int smartwatch_main(void){
             }
             if(flags.full){
 
+                check_for_new_day(&now);
                 update_time(&now);
                 end_screen();
+                report_render_stats();
+                report_sched_stats();
                 flags.full=0;
             }
-            if(flags.one_half){
-                uint8_t bpm_read = calculate_heart_rate();
-                if(bpm_read!=255)bpm=bpm_read;
-                update_hr(bpm);
+            if (flags.render){
+                flags.render=false;
                 end_screen();
-                flags.one_half=0;
-            }
-            if (flags.five_mil){  
-                check_for_new_day(&now);      
-                lv_obj_invalidate(screen1);
-                lv_task_handler(); //esto tiene que suceder cada 5ms
-                flags.five_mil=false;
             }
+            sched_stats.busy_us[sched_mode] += time_us_32() - wake_us;
         }
         else{__wfi();}
     }
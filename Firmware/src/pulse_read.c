@@ -24,231 +24,141 @@
 beat_detector_t detect={
     .sample_rate=50,
     .window_size=200,
-    .smoothing_window=15,
-    .round=0,
-    .peak_len=0
+    .filters_ready=false,
+    .seq=0,
+    .above=false,
+    .has_beat=false,
+    .new_beat=false
 };
 
+//Low pass FIR of 23 taps for the DC-free signal at 50 Hz, Q15, from the edge to the center
+const int16_t pulse_fir_coefs[PULSE_FIR_HALF + 1] = {
+    172, 321, 579, 927, 1360, 1858, 2390, 2916, 3391, 3768, 4012, 4096
+};
 
-void add_sample(uint32_t sample){
-    uint32_t timestamp = time_us_32()/1000; //write it down in ms!
-    detect.sample[detect.round]=sample;
-    detect.timestamps[detect.round]=timestamp;
-    //printf("round%d\n",detect.round);
-    //printf(">sample:%d,",detect.sample[detect.round]);
-    //Smooth the signal?
-    uint32_t smoothed_sample;
-    if (detect.round >= detect.smoothing_window-1){
-        smoothed_sample=0;
-        for (uint8_t i=0;i<detect.smoothing_window;i++){
-            smoothed_sample+=detect.sample[detect.round-i];
-        }
-        smoothed_sample = smoothed_sample/detect.smoothing_window;
-        //printf("Smooth:%d\r\n",smoothed_sample);
-        detect.filtered_samples[detect.round]=smoothed_sample;
-    }else{
-        detect.filtered_samples[detect.round]=sample;
-    }
-
-
-    if (detect.round>=detect.window_size-1){
-        for (int k = 0; k < detect.window_size-1; k++) detect.sample[k]=detect.sample[k+1];
-        for (int k = 0; k < detect.window_size-1; k++) detect.timestamps[k]=detect.timestamps[k+1];
-        for (int k = 0; k < detect.window_size-1; k++) detect.filtered_samples[k]=detect.filtered_samples[k+1];
-    }else{
-    //Maintain the size of samples and timestamps
-    detect.round++;}
-}
-
-void find_peaks(uint32_t peaks[32][2]){
-    //Find peaks in the filtered samples.
-    detect.peak_len=0;
-    if (detect.round<3){
-        printf("Not enough!!!");
-        return; //return peaks
-    }
+//Band pass of about 0.6 to 3.6 Hz (36 to 216 bpm) for the DC-free signal at 50 Hz: b0, b1, b2, a1, a2
+const int16_t pulse_bandpass_coefs[5] = {
+    FILTER_Q14(0.1180443), 0, FILTER_Q14(-0.1180443), FILTER_Q14(-1.7326677), FILTER_Q14(0.7639114)
+};
 
-    //Calculate dynamic threshold based on the min and max of the recent window of filtered samples
-    uint32_t min_val = ~0;
-    for (uint8_t i=0;i<detect.window_size;i++){
-        if(detect.filtered_samples[detect.round-i]<min_val) min_val=detect.filtered_samples[detect.round-i];
-    }
+//Value of a sample still in the ring
+#define VALUE_OF(seq) (detect.filtered_samples[(seq) & PULSE_RING_MASK])
 
-    uint32_t max_val = 0;
-    for (uint8_t i=0;i<detect.window_size;i++){
-        if(detect.filtered_samples[detect.round-i]>max_val) max_val=detect.filtered_samples[detect.round-i];
+static inline void PULSE_FAST_FUNC(deque_push)(pulse_deque_t *q, uint16_t seq, int32_t value, bool is_max){
+    //The samples that left the window go out of the front
+    while (q->len && (uint16_t)(seq - q->seq[q->head]) >= detect.window_size){
+        q->head = (q->head + 1) & PULSE_RING_MASK;
+        q->len--;
     }
-
-    uint32_t threshold= min_val + (max_val - min_val) * 0.5;// 50% between min and max as a threshold
-    if(threshold>10000){ //pulse valid
-        for (uint8_t i=1; i<detect.round-1; i++){
-            if (detect.filtered_samples[i] > threshold && detect.filtered_samples[i - 1] < detect.filtered_samples[i] && detect.filtered_samples[i] > detect.filtered_samples[i + 1]){
-                    peaks[detect.peak_len][0]=(uint32_t)detect.timestamps[i];
-                    uint32_t placeholder=detect.filtered_samples[i];
-                    peaks[detect.peak_len][1]= placeholder;
-                    detect.peak_len++;
-            }
-        }
+    //The ones the new sample beats can't be the extreme anymore
+    while (q->len){
+        int32_t back = VALUE_OF(q->seq[(q->head + q->len - 1) & PULSE_RING_MASK]);
+        if (is_max ? back > value : back < value) break;
+        q->len--;
     }
-
+    q->seq[(q->head + q->len) & PULSE_RING_MASK] = seq;
+    q->len++;
 }
 
-uint8_t calculate_heart_rate(){
-    uint32_t peaks[32][2];
-    find_peaks(peaks);
-
-    if (detect.peak_len<2){
-        return 0xFF;
+static void PULSE_FAST_FUNC(beat_found)(uint32_t timestamp){
+    uint32_t interval = timestamp - detect.beat.timestamp;
+    if (detect.has_beat && interval < PULSE_MIN_INTERVAL_MS) return; //noise, too close to the last beat
+
+    detect.beats++;
+    detect.beat.timestamp = timestamp;
+    if (!detect.has_beat || interval > PULSE_MAX_INTERVAL_MS){
+        //First beat or the pulse was lost, start averaging again
+        detect.has_beat = true;
+        detect.interval_count = 0;
+        detect.interval_pos = 0;
+        return;
     }
 
-    uint32_t intervals[32];
-
-    for(uint8_t j = 1; j<detect.peak_len; j++){
-        intervals[j-1]=peaks[j][0]-peaks[j-1][0]; //this is in ms
-    }
-    //la longitud final de intervals es de peak_len-1
-    uint32_t average_interval=0;
-    for (uint8_t i=0;i<detect.peak_len-1;i++){
-        //printf("Int: %d ",intervals[i]);
-        average_interval+=intervals[i];
-    }
-    average_interval=average_interval/(detect.peak_len-1);
-    //printf("AVG: %d\n ",average_interval);
+    detect.intervals[detect.interval_pos] = interval;
+    detect.interval_pos = (detect.interval_pos + 1) % PULSE_BEAT_AVG;
+    if (detect.interval_count < PULSE_BEAT_AVG) detect.interval_count++;
 
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < detect.interval_count; i++) sum += detect.intervals[i];
     // Convert intervals to heart rate in beats per minute (BPM)
-    uint16_t heart_rate =(60000 / average_interval);  // 60 seconds per minute * 1000 ms per second
-    return (uint8_t)heart_rate;
-
+    detect.beat.interval_ms = interval;
+    detect.beat.bpm = 60000 * detect.interval_count / sum;
+    detect.new_beat = true;
 }
 
-
-
-
-/*
-//  Heart Rate Monitor functions takes a sample value and the sample number
-//  Returns true if a beat is detected
-//  A running average of four samples is recommended for display on the screen.
-void get_bpm(){
-    uint8_t rates[AVG_SIZE]; //Array of heart rates
-    uint8_t rateSpot = 0;
-    uint32_t lastBeat = 0; //Time at which the last beat occurred
-
-    static uint16_t beatsPerMinute;
-    static uint8_t beatAvg=0;
-
-    uint32_t irValue = pulse_getIR();
-    //printf(">ir:%d,",irValue);
-    if (checkForBeat(irValue) == true){
-        //We sensed a beat!
-        uint32_t delta = (time_us_32() - lastBeat)/1000; //in ms!
-        lastBeat = time_us_32();
-        beatsPerMinute = 60 * 1000 / delta;
-        //printf("Delta in ms: %d,bpm:%d\n",delta,beatsPerMinute);
-
-        if (beatsPerMinute < 255 && beatsPerMinute > 20){
-            rates[rateSpot++] = (uint8_t)beatsPerMinute; //Store this reading in the array
-            rateSpot %= AVG_SIZE; //Wrap variable
-
-            //Take average of readings
-            beatAvg = 0;
-            for (uint8_t x = 0 ; x < AVG_SIZE ; x++)
-                beatAvg += rates[x];
-            beatAvg /= AVG_SIZE;
-            printf("IR=%d ",irValue);
-            printf("BPM=%d ",beatsPerMinute);
-            printf("AVG_BPM=%d\n",beatAvg);
+static inline void PULSE_FAST_FUNC(detect_beat)(int32_t value, uint32_t timestamp, bool finger){
+    uint16_t seq = detect.seq++;
+    detect.filtered_samples[seq & PULSE_RING_MASK] = value;
+    detect.last_time = timestamp;
+    deque_push(&detect.min_q, seq, value, false);
+    deque_push(&detect.max_q, seq, value, true);
+
+    //Dynamic threshold 50% between the min and max of the window
+    int32_t min_val = VALUE_OF(detect.min_q.seq[detect.min_q.head]);
+    int32_t range = VALUE_OF(detect.max_q.seq[detect.max_q.head]) - min_val;
+    int32_t threshold = min_val + (range >> 1);
+    int32_t hysteresis = range >> 3;
+
+    if (!detect.above){
+        if (finger && value > threshold + hysteresis){ //pulse valid
+            detect.above = true;
+            detect.peak_val = value;
+            detect.peak_time = timestamp;
+        }
+    }else{
+        if (value > detect.peak_val){
+            detect.peak_val = value;
+            detect.peak_time = timestamp;
+        }
+        if (value + hysteresis < threshold){
+            detect.above = false;
+            beat_found(detect.peak_time);
         }
     }
+}
 
-    if (irValue < 50000){
-        printf(" No finger?\n");
-    }
+void PULSE_FAST_FUNC(add_sample)(uint32_t sample){
+    add_sample_at(sample, time_us_32()/1000); //write it down in ms!
 }
 
-bool checkForBeat(int32_t sample){
-
-    //Creating local variables
-    bool beatDetected = false;
-
-    int16_t IR_AC_Signal_Previous;
-    static int16_t IR_AC_Signal_Current;
-    static int32_t ir_avg_reg;
-    static uint8_t positiveEdge;
-    static uint8_t negativeEdge;
-    static int16_t IR_AC_Signal_min;
-    static int16_t IR_AC_Signal_max;
-
-    //  Save current state
-    IR_AC_Signal_Previous=IR_AC_Signal_Current;
-    //This is good to view for debugging
-    //printf(">Signal:%d,",IR_AC_Signal_Current);
-
-    //  Process next data sample
-    int16_t IR_Average_Estimated = averageDCEstimator(&ir_avg_reg, sample);
-    //printf("avg:%d\r\n",IR_Average_Estimated);
-
-    IR_AC_Signal_Current = lowPassFIRFilter(sample - IR_Average_Estimated);
-    //printf("Ac_sig%d\n",IR_AC_Signal_Current);
-    //  Detect positive zero crossing (rising edge)
-    if ((IR_AC_Signal_Previous < 0) & (IR_AC_Signal_Current >= 0)){
-        printf("Rising!!!! ");
-        IR_AC_Max = IR_AC_Signal_max; //Adjust our AC max and min
-        IR_AC_Min = IR_AC_Signal_min;
-        printf("Max: %d Min: %d \n",IR_AC_Max,IR_AC_Min);
-        positiveEdge = 1;
-        negativeEdge = 0;
-        IR_AC_Signal_max = 0;
-
-        //if ((IR_AC_Max - IR_AC_Min) > 100 & (IR_AC_Max - IR_AC_Min) < 1000)
-        if ((IR_AC_Max - IR_AC_Min) > 20 & (IR_AC_Max - IR_AC_Min) < 1000){
-            //Heart beat!!!
-            printf("Beat!!!");
-            beatDetected = true;
-        }
-    }
-    
-    //  Detect negative zero crossing (falling edge)
-    if ((IR_AC_Signal_Previous > 0) & (IR_AC_Signal_Current <= 0)){
-        positiveEdge = 0;
-        negativeEdge = 1;
-        IR_AC_Signal_min = 0;
-    }
+void PULSE_FAST_FUNC(add_sample_at)(uint32_t sample, uint32_t timestamp){
+    add_samples_at(&sample, 1, timestamp, 0);
+}
 
-    //  Find Maximum value in positive cycle
-    if (positiveEdge & (IR_AC_Signal_Current > IR_AC_Signal_Previous)){
-        IR_AC_Signal_max = IR_AC_Signal_Current;
+void PULSE_FAST_FUNC(add_samples_at)(const uint32_t *samples, uint16_t n, uint32_t timestamp, uint16_t period_ms){
+    if (!detect.filters_ready){
+        filter_dc_init(&detect.dc, PULSE_DC_SHIFT);
+        filter_biquad_init(&detect.bandpass, pulse_bandpass_coefs);
+        detect.filters_ready = true;
     }
 
-    //  Find Minimum value in negative cycle
-    if (negativeEdge & (IR_AC_Signal_Current < IR_AC_Signal_Previous)){
-        IR_AC_Signal_min = IR_AC_Signal_Current;
+    int32_t filtered[PULSE_BLOCK];
+    while (n > 0){
+        uint16_t block = n < PULSE_BLOCK ? n : PULSE_BLOCK;
+        //Remove the DC level and keep the band of the pulse, this also takes out most of the breathing
+        filter_dc_block(&detect.dc, (const int32_t *)samples, filtered, block);
+        filter_biquad_block(&detect.bandpass, filtered, filtered, block);
+        //Without a finger on the sensor the IR level is low
+        bool finger = (detect.dc.acc >> 8) > PULSE_MIN_LEVEL;
+        for (uint16_t i = 0; i < block; i++){
+            detect_beat(filtered[i], timestamp, finger);
+            timestamp += period_ms;
+        }
+        samples += block;
+        n -= block;
     }
-    return(beatDetected);
 }
 
-//  Average DC Estimator
-int16_t averageDCEstimator(int32_t *p, uint16_t x)
-{
-  *p += ((((uint32_t) x << 15) - *p) >> 4);
-  return (*p >> 15);
+bool pulse_get_beat(pulse_beat_t *beat){
+    if (!detect.new_beat) return false;
+    *beat = detect.beat;
+    detect.new_beat = false;
+    return true;
 }
 
-//  Low Pass FIR Filter, pray for me
-int16_t lowPassFIRFilter(int16_t din){
-    static int16_t cbuf[32];
-    static uint8_t offset; 
-    cbuf[offset] = din;
-    int32_t z = mul16(FIRCoeffs[11], cbuf[(offset - 11) & 0x1F]);
-  
-    for (uint8_t i = 0 ; i < 11 ; i++){
-        z += mul16(FIRCoeffs[i], cbuf[(offset - i) & 0x1F] + cbuf[(offset - 22 + i) & 0x1F]);
+uint8_t calculate_heart_rate(){
+    if (detect.interval_count == 0 || detect.last_time - detect.beat.timestamp > PULSE_MAX_INTERVAL_MS){
+        return PULSE_LOST;
     }
-    offset++;
-    offset %= 32; //Wrap condition
-    return(z >> 15);
+    return detect.beat.bpm;
 }
-
-//  Integer multiplier
-int32_t mul16(int16_t x, int16_t y){
-  return((uint32_t)x * (uint32_t)y);
-}*/
\ No newline at end of file
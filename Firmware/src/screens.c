@@ -0,0 +1,387 @@
+/**
+ * @file screens.c
+ * 
+ * @brief Archivo que contiene la construcción y actualización de las pantallas del smartwatch.
+ * 
+ * Este archivo contiene los widgets de LVGL de la pantalla principal y las funciones que
+ * los actualizan con los datos de los sensores. No depende del driver del display, así que
+ * también se compila en el PC con el backend de @see host_display.c.
+ * 
+ * @authors Maria Del Mar Arbelaez Sandoval
+ *          Manuel Santiago Velasquez
+ *          Julián Mauricio Sánchez Ceballos
+ * 
+ * @see screens.h
+ * @see lib.c
+ * 
+ * @date 25/11/2024
+ */
+
+#include "../include/screens.h"
+
+lv_obj_t *screen1;
+static lv_obj_t *label_steps;
+static lv_obj_t *label_time;
+static lv_obj_t *label_date;
+static lv_obj_t *label_battery;
+static lv_obj_t *label_calories;
+static lv_obj_t *label_distance;
+
+static lv_obj_t *bar_steps;
+
+
+static lv_obj_t *arc_calories, *arc_distance;
+
+static lv_obj_t *heart_circle;
+static lv_obj_t *label_pulse;
+
+#if PULSE_SPRITE
+static lv_coord_t pulse_radius = PULSE_RADIUS_MIN;
+static lv_draw_rect_dsc_t pulse_dsc;
+#endif
+static pulse_stats_t pulse_stats;
+static uint32_t pulse_draw_start_us[LV_DRAW_CORES];
+static uint32_t pulse_draw_us[LV_DRAW_CORES];
+static uint32_t pulse_draws[LV_DRAW_CORES];
+
+
+/**
+ * @brief Cambia el texto de un label solo si es distinto al que ya muestra.
+ * 
+ * En modo @ref RENDER_DIRTY_ONLY evita invalidar el label cuando el valor no cambió.
+ * 
+ * @param label label a actualizar.
+ * @param text nuevo texto.
+ * 
+ * @return true si el texto cambió y el label quedó invalidado.
+ */
+static bool label_set_text_dirty(lv_obj_t *label, const char *text)
+{
+#if RENDER_DIRTY_ONLY
+    if (strcmp(lv_label_get_text(label), text) == 0) return false;
+#endif
+    lv_label_set_text(label, text);
+    return true;
+}
+
+#if PULSE_SPRITE
+/**
+ * @brief Calcula el área del círculo del pulso, centrado en el objeto del indicador.
+ *
+ * @param area área de salida, en coordenadas de la pantalla.
+ * @param radius radio del círculo.
+ */
+static void pulse_area(lv_area_t *area, lv_coord_t radius) {
+    lv_coord_t cx = heart_circle->coords.x1 + PULSE_RADIUS_MAX;
+    lv_coord_t cy = heart_circle->coords.y1 + PULSE_RADIUS_MAX;
+
+    area->x1 = cx - radius;
+    area->y1 = cy - radius;
+    area->x2 = cx + radius - 1;
+    area->y2 = cy + radius - 1;
+}
+
+/**
+ * @brief Cambia el radio del círculo sin tocar el objeto: invalida la unión del círculo anterior
+ * y el nuevo, sin refrescar estilos ni recalcular el layout.
+ */
+static void heart_pulse_cb(void *obj, int32_t value) {
+    uint32_t start_us = time_us_32();
+
+    if (value != pulse_radius) {
+        lv_area_t old_area, new_area;
+        pulse_area(&old_area, pulse_radius);
+        pulse_area(&new_area, value);
+        _lv_area_join(&new_area, &old_area, &new_area);
+        pulse_radius = value;
+        lv_obj_invalidate_area(obj, &new_area);
+    }
+
+    pulse_stats.steps++;
+    pulse_stats.anim_us += time_us_32() - start_us;
+}
+
+/**
+ * @brief Dibuja el círculo con el radio actual. Los radios de la animación están en
+ * LV_CIRCLE_TABLE_RADII, así el borde con antialiasing sale de las tablas en flash.
+ */
+static void pulse_sprite_draw_cb(lv_event_t *e) {
+    lv_area_t area;
+
+    pulse_area(&area, pulse_radius);
+    lv_draw_rect(&area, lv_event_get_clip_area(e), &pulse_dsc);
+}
+#else
+static void heart_pulse_cb(void *obj, int32_t value) {
+    uint32_t start_us = time_us_32();
+
+    lv_obj_set_style_radius(obj, value, 0);
+    lv_obj_set_size(obj, value *2, value *2);
+    lv_obj_align(obj, LV_ALIGN_CENTER, 50, -10);
+
+    pulse_stats.steps++;
+    pulse_stats.anim_us += time_us_32() - start_us;
+}
+#endif
+
+/**
+ * @brief Mide el tiempo de dibujo del indicador del pulso en cada core, desde el inicio del
+ * dibujo principal hasta el final del posterior.
+ */
+static void pulse_draw_time_cb(lv_event_t *e) {
+    uint8_t core = LV_DRAW_CORE_ID();
+
+    if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN) {
+        pulse_draw_start_us[core] = time_us_32();
+    } else {
+        pulse_draw_us[core] += time_us_32() - pulse_draw_start_us[core];
+        pulse_draws[core]++;
+    }
+}
+
+static void create_heart_pulse_indicator (lv_obj_t *parent) {
+    heart_circle = lv_obj_create(parent);
+#if PULSE_SPRITE
+    // El círculo toma el aspecto del tema y luego el objeto queda sin estilos, de tamaño fijo
+    lv_obj_set_style_radius(heart_circle, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(heart_circle, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_draw_rect_dsc_init(&pulse_dsc);
+    lv_obj_init_draw_rect_dsc(heart_circle, LV_PART_MAIN, &pulse_dsc);
+    lv_obj_remove_style_all(heart_circle);
+    lv_obj_clear_flag(heart_circle, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(heart_circle, PULSE_RADIUS_MAX * 2, PULSE_RADIUS_MAX * 2);
+    lv_obj_add_event_cb(heart_circle, pulse_sprite_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+#else
+    lv_obj_set_size(heart_circle, 10, 10);
+    lv_obj_set_style_radius(heart_circle, 5, 0);
+    lv_obj_set_style_bg_color(heart_circle, lv_palette_main(LV_PALETTE_RED), 0);
+#endif
+    lv_obj_align(heart_circle, LV_ALIGN_CENTER, 50, -10);
+    lv_obj_add_event_cb(heart_circle, pulse_draw_time_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_obj_add_event_cb(heart_circle, pulse_draw_time_cb, LV_EVENT_DRAW_POST_END, NULL);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, heart_circle);
+    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)heart_pulse_cb);
+    lv_anim_set_values(&a, PULSE_RADIUS_MIN, PULSE_RADIUS_MAX);
+    lv_anim_set_time(&a, 400);
+    lv_anim_set_playback_time(&a, 400);
+    lv_anim_set_playback_time(&a, 400);
+    lv_anim_set_repeat_delay(&a, 200);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+
+    label_pulse = lv_label_create(parent);
+    lv_label_set_text(label_pulse, "70 bpm");
+    lv_obj_set_style_text_font(label_pulse, FONT_UI_10, 0);
+    lv_obj_align_to(label_pulse, heart_circle, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
+}
+
+void create_screen1 (void) {
+    
+    screen1 = lv_obj_create(NULL);
+
+    // WIDGET DE LA HORA
+    label_time = lv_label_create(screen1);
+    lv_label_set_text(label_time, "15:45");
+    lv_obj_set_style_text_font(label_time, FONT_UI_48, 0);
+    lv_obj_align(label_time, LV_ALIGN_CENTER, 0, -70);
+
+    // WIDGET DE LA FECHA (DEBAJO DE LA HORA)
+    label_date = lv_label_create(screen1);
+    lv_label_set_text(label_date, "10/12/2024 WED");
+    lv_obj_set_style_text_font(label_date, FONT_UI_18, 0);
+    lv_obj_align(label_date, LV_ALIGN_CENTER, 0, -40);
+
+
+    // WIDGET DE LA BATERIA
+    label_battery = lv_label_create(screen1);
+    lv_label_set_text(label_battery, LV_SYMBOL_BATTERY_FULL "100%");
+    lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -90, 7);
+
+    // BARRA DE PROGRESO DE LOS PASOS
+    bar_steps = lv_bar_create(screen1);
+    lv_obj_set_size(bar_steps, 100, 20);
+    lv_bar_set_range(bar_steps, 0, 1000);
+    lv_bar_set_value(bar_steps, 0, LV_ANIM_OFF);
+    lv_obj_align(bar_steps, LV_ALIGN_CENTER, -50, -10);
+
+    label_steps = lv_label_create(screen1);
+    lv_label_set_text(label_steps, "Steps: 0");
+    lv_obj_set_style_text_font(label_steps, FONT_UI_10, 0);
+    lv_obj_align_to(label_steps, bar_steps, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+
+
+    // WIDGET DE LAS CALORIAS
+    arc_calories = lv_arc_create(screen1);
+    lv_obj_set_size(arc_calories, 45, 45);
+    lv_arc_set_rotation(arc_calories, 270);
+    lv_arc_set_bg_angles(arc_calories, 0, 360);
+    lv_obj_remove_style(arc_calories, NULL, LV_PART_KNOB);
+    lv_arc_set_value(arc_calories, 0);
+    lv_obj_align(arc_calories, LV_ALIGN_CENTER, -40, 45);
+
+    label_calories = lv_label_create(screen1);
+    lv_label_set_text(label_calories, "0");
+    lv_obj_set_style_text_font(label_calories, FONT_UI_10, 0);
+    lv_obj_align_to(label_calories, arc_calories, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+
+
+    // WIDGET DE LA DISTANCIA
+    arc_distance = lv_arc_create(screen1);
+    lv_obj_set_size(arc_distance, 45, 45);
+    lv_arc_set_rotation(arc_distance, 270);
+    lv_arc_set_bg_angles(arc_distance, 0, 360);
+    lv_obj_remove_style(arc_distance, NULL, LV_PART_KNOB);
+    lv_arc_set_value(arc_distance, 0);
+    lv_obj_align(arc_distance, LV_ALIGN_CENTER, 40, 45);
+
+    label_distance = lv_label_create(screen1);
+    lv_label_set_text(label_distance, "0m");
+    lv_obj_set_style_text_font(label_distance, FONT_UI_10, 0);
+    lv_obj_align_to(label_distance, arc_distance, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+
+    //Heart Pulse Indicator
+    create_heart_pulse_indicator(screen1);
+
+
+}
+
+void save_steps(uint32_t offset, uint32_t*steps){
+    *steps=offset+*steps;
+    
+    uint8_t step_low = *steps & 0xFF;
+    uint8_t step_mid = (*steps>>8) & 0xFF;
+    uint8_t step_high = (*steps>>16) &0XFF; 
+
+    //escritura en memoria
+    SetMemory(4,step_low);
+    SetMemory(5,step_mid);
+    SetMemory(6,step_high);  
+}
+
+void update_steps(uint32_t*steps,uint32_t offset){
+    *steps = read_imu_step_count();
+    save_steps(offset,steps);
+    char steps_str[32];
+    snprintf(steps_str, sizeof(steps_str), "Steps: %d", (*steps%1001)); //texto de abajo
+    //printf("udapted text: %s\n", steps_str);
+
+    lv_bar_set_value(bar_steps, *steps, LV_ANIM_OFF);
+
+    if (label_set_text_dirty(label_steps, steps_str)) {
+        lv_obj_align_to(label_steps, bar_steps, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+    }
+
+}
+
+void update_time(datetime_t*now){
+    const char* dotw_lookup[] = {"SUN","MON","TUE","WED", "THU", "FRI","SUN"};
+    GetDateTime(now);
+
+    //hour and minutes section
+    char time_str[32];
+    snprintf(time_str, sizeof(time_str), "%.2d:%.2d",now->hour,now->min); //texto de abajo
+
+    if (label_set_text_dirty(label_time, time_str)) {
+        lv_obj_align(label_time, LV_ALIGN_CENTER, 0, -70);
+    }
+
+    //date section
+    snprintf(time_str, sizeof(time_str),"%.2d/%.2d/%.4d %.3s",now->day,now->month,now->year,dotw_lookup[now->dotw]); //texto de abajo
+
+    // WIDGET DE LA FECHA (DEBAJO DE LA HORA)
+    if (label_set_text_dirty(label_date, time_str)) {
+        lv_obj_align(label_date, LV_ALIGN_CENTER, 0, -40);
+    }
+}
+
+void update_distance(uint32_t steps){
+    uint8_t height=GetMemory(2);
+    uint32_t distance=steps*height*0.414/100; //size of step according to height in m
+    uint8_t angle=(100*distance/750)%101; //750m is the top distance to show
+    
+    lv_arc_set_value(arc_distance, angle);
+
+    //hour and minutes section
+    char dist_str[32];
+    snprintf(dist_str, sizeof(dist_str), "%dm",distance); //texto de abajo
+
+    if (label_set_text_dirty(label_distance, dist_str)) {
+        lv_obj_align_to(label_distance, arc_distance, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+    }
+}
+
+void update_battery(){
+    char symbol[12] = "";
+
+    uint16_t voltage = 33*adc_read() / (1 << 12) * 2;
+    uint16_t percent=100*(voltage - 30) / (40 - 30);
+    //printf("v:%d,p:%d\n",voltage,percent);
+    
+    if(voltage>=40){
+        percent=100;
+        strcpy(symbol, LV_SYMBOL_BATTERY_FULL);
+    }else if(voltage>=37){
+        strcpy(symbol, LV_SYMBOL_BATTERY_3);
+    }else if(voltage>=35){
+        strcpy(symbol, LV_SYMBOL_BATTERY_2);
+    }else if(voltage>=30){
+        strcpy(symbol, LV_SYMBOL_BATTERY_1);
+    }else if(voltage>=25){
+        strcpy(symbol, LV_SYMBOL_BATTERY_EMPTY);
+    }
+
+    char per_str[10];
+    snprintf(per_str, sizeof(per_str), "%d%%",percent); //texto de abajo
+    strcat(symbol, per_str);
+
+    if (label_set_text_dirty(label_battery, symbol)) {
+        lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -90, 7);
+    }
+
+}
+
+void update_hr(uint8_t bpm){
+    char bpm_str[4];
+    if (bpm == 0xFF) strcpy(bpm_str, "--"); //PULSE_LOST, sin latidos
+    else snprintf(bpm_str, sizeof(bpm_str), "%d",bpm); //texto de abajo
+
+    if (label_set_text_dirty(label_pulse, bpm_str)) {
+        lv_obj_align_to(label_pulse, heart_circle, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
+    }
+}
+
+void update_calories(uint32_t steps,uint8_t bpm){
+    uint8_t weight=GetMemory(1);
+    uint8_t height=GetMemory(2);
+    uint8_t age=GetMemory(3);
+    uint32_t dist=steps*height*0.414/100; //size of step according to height in m
+    uint32_t cals=(dist/0.13)*(0.6309*bpm+0.1988*weight+0.2017*age-55.0969)/4.184;
+    uint8_t cals_per=cals*100/150000; //let's say that the max is 250 kcals
+
+    char cals_str[16];
+    snprintf(cals_str, sizeof(cals_str), "%dcals",cals); //texto de abajo
+
+    lv_arc_set_value(arc_calories, cals_per);
+
+    if (label_set_text_dirty(label_calories, cals_str)) {
+        lv_obj_align_to(label_calories, arc_calories, LV_ALIGN_OUT_BOTTOM_MID, 0, 3);
+    }
+
+}
+
+void get_pulse_stats(pulse_stats_t *stats, bool reset){
+    *stats = pulse_stats;
+    for (uint8_t core = 0; core < LV_DRAW_CORES; core++) {
+        stats->draw_us += pulse_draw_us[core];
+        stats->draws += pulse_draws[core];
+    }
+
+    if (reset) {
+        memset(&pulse_stats, 0, sizeof(pulse_stats));
+        memset(pulse_draw_us, 0, sizeof(pulse_draw_us));
+        memset(pulse_draws, 0, sizeof(pulse_draws));
+    }
+}